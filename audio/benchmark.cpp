@@ -0,0 +1,210 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// FIXME: Avoid using printf
+#define FORBIDDEN_SYMBOL_EXCEPTION_printf
+
+#include "common/array.h"
+#include "common/fs.h"
+#include "common/stream.h"
+#include "common/system.h"
+
+#include "audio/benchmark.h"
+#include "audio/fmopl.h"
+#include "audio/softsynth/sid.h"
+
+namespace Audio {
+
+Common::Error benchmarkOPL(const Common::String &filename) {
+	Common::SeekableReadStream *stream = Common::FSNode(filename).createReadStream();
+	if (!stream)
+		return Common::Error(Common::kReadingFailed, filename);
+
+	char signature[8];
+	stream->read(signature, sizeof(signature));
+	const uint16 versionMajor = stream->readUint16LE();
+	/* uint16 versionMinor = */ stream->readUint16LE();
+
+	if (memcmp(signature, "DBRAWOPL", sizeof(signature)) || versionMajor != 2) {
+		delete stream;
+		return Common::Error(Common::kUnknownError, "'" + filename + "' is not a version 2 DRO file");
+	}
+
+	const uint32 pairCount = stream->readUint32LE();
+	const uint32 lengthMs = stream->readUint32LE();
+	const byte hardwareType = stream->readByte();
+	const byte format = stream->readByte();
+	const byte compression = stream->readByte();
+	const byte shortDelayCode = stream->readByte();
+	const byte longDelayCode = stream->readByte();
+	const byte codemapLength = stream->readByte();
+
+	byte codemap[128];
+	if (format != 0 || compression != 0 || codemapLength > sizeof(codemap)) {
+		delete stream;
+		return Common::Error(Common::kUnknownError, "Unsupported DRO data format in '" + filename + "'");
+	}
+
+	stream->read(codemap, codemapLength);
+
+	// Read the whole capture first, so that only the rendering is timed
+	Common::Array<byte> data;
+	data.resize(pairCount * 2);
+	if (pairCount)
+		stream->read(&data[0], pairCount * 2);
+
+	const bool readError = stream->err() || stream->eos();
+	delete stream;
+
+	if (readError)
+		return Common::Error(Common::kReadingFailed, filename);
+
+	const OPL::Config::OplType type = (hardwareType == 2) ? OPL::Config::kOpl3 :
+			(hardwareType == 1) ? OPL::Config::kDualOpl2 : OPL::Config::kOpl2;
+
+	OPL::OPL *opl = OPL::Config::create(type);
+	if (!opl)
+		return Common::Error(Common::kUnknownError, "No OPL emulator available");
+
+	const int rate = 44100;
+	opl->init(rate);
+
+	const int channels = opl->isStereo() ? 2 : 1;
+	int16 buffer[1024 * 2];
+	uint32 timeMs = 0;
+	uint32 renderedSamples = 0;
+
+	const uint32 startTime = g_system->getMillis();
+
+	for (uint32 i = 0; i < pairCount; i++) {
+		const byte code = data[i * 2];
+		const byte value = data[i * 2 + 1];
+
+		if (code == shortDelayCode || code == longDelayCode) {
+			timeMs += (code == shortDelayCode) ? (value + 1) : ((value + 1) << 8);
+
+			const uint32 targetSamples = (timeMs / 1000) * rate + (timeMs % 1000) * rate / 1000;
+			while (renderedSamples < targetSamples) {
+				const uint32 step = MIN<uint32>(targetSamples - renderedSamples, 1024);
+				opl->readBuffer(buffer, step * channels);
+				renderedSamples += step;
+			}
+		} else if ((code & 0x7F) < codemapLength) {
+			// The high bit selects the second chip or register set
+			const int port = (code & 0x80) ? 0x222 : 0x220;
+			opl->write(port, codemap[code & 0x7F]);
+			opl->write(port + 1, value);
+		}
+	}
+
+	const uint32 totalTime = g_system->getMillis() - startTime;
+	delete opl;
+
+	printf("Capture:  %s (%s, %d ms)\n", filename.c_str(),
+			(type == OPL::Config::kOpl3) ? "OPL3" : (type == OPL::Config::kDualOpl2) ? "dual OPL2" : "OPL2", lengthMs);
+	printf("Rendered: %d samples at %d Hz in %d ms (%.1fx real time)\n", renderedSamples, rate, totalTime,
+			totalTime ? (renderedSamples * 1000.0 / rate) / totalTime : 0.0);
+
+	return Common::kNoError;
+}
+
+#ifndef DISABLE_SID
+static uint32 renderSIDProgram(Resid::sampling_method method, int seconds) {
+	// A PAL C64 runs at 985248 Hz, the program is updated 50 times a second
+	const int clockFreq = 985248;
+	const int frameCycles = clockFreq / 50;
+	static const byte waveforms[] = { 0x10, 0x20, 0x40, 0x80, 0x30, 0x50, 0x60, 0x70, 0x14, 0x42, 0x22, 0x12 };
+
+	Resid::SID sid;
+	sid.set_sampling_parameters(clockFreq, method, 44100);
+	sid.enable_filter(true);
+	sid.reset();
+
+	int16 buffer[2048];
+	Resid::cycle_count cyclesLeft = 0;
+	uint32 renderedSamples = 0;
+
+	for (int frame = 0; frame < seconds * 50; frame++) {
+		// Notes of all waveforms on the three voices, including hard sync and
+		// ring modulation, with a sweeping filter
+		for (int v = 0; v < 3; v++) {
+			const int reg = v * 7;
+			const int n = frame / (4 + v) + v * 5;
+
+			if (frame % (4 + v) == 0) {
+				const int freq = 0x0400 + ((n * 2719 + v * 1237) & 0x3FFF);
+				sid.write(reg + 0, freq & 0xFF);
+				sid.write(reg + 1, freq >> 8);
+				sid.write(reg + 2, (n * 37) & 0xFF);
+				sid.write(reg + 3, (n >> 2) & 0x0F);
+				sid.write(reg + 5, ((n * 3) & 0x0F) << 4 | ((n * 5) & 0x0F));
+				sid.write(reg + 6, ((n * 7 + 8) & 0x0F) << 4 | ((n * 11) & 0x0F));
+				sid.write(reg + 4, waveforms[n % ARRAYSIZE(waveforms)] | 1);
+			} else if (frame % (4 + v) == 2) {
+				sid.write(reg + 4, waveforms[n % ARRAYSIZE(waveforms)]);
+			}
+		}
+
+		const int cutoff = (frame * 13) & 0x7FF;
+		sid.write(0x15, cutoff & 7);
+		sid.write(0x16, cutoff >> 3);
+		sid.write(0x17, ((frame / 50) & 0x0F) << 4 | ((frame / 25) & 7));
+		sid.write(0x18, ((frame / 40) & 7) << 4 | 0x0F);
+
+		cyclesLeft += frameCycles;
+		while (cyclesLeft > 0)
+			renderedSamples += sid.updateClock(cyclesLeft, buffer, ARRAYSIZE(buffer));
+	}
+
+	return renderedSamples;
+}
+
+Common::Error benchmarkSID(int seconds) {
+	if (seconds <= 0)
+		return Common::Error(Common::kUnknownError, "Invalid SID benchmark length");
+
+	static const struct {
+		Resid::sampling_method method;
+		const char *name;
+	} modes[] = {
+		{ Resid::SAMPLE_FAST, "fast" },
+		{ Resid::SAMPLE_INTERPOLATE, "interpolate" }
+	};
+
+	for (uint i = 0; i < ARRAYSIZE(modes); i++) {
+		const uint32 startTime = g_system->getMillis();
+		const uint32 renderedSamples = renderSIDProgram(modes[i].method, seconds);
+		const uint32 totalTime = g_system->getMillis() - startTime;
+
+		printf("%-12s %d samples at 44100 Hz in %d ms (%.1fx real time)\n", modes[i].name, renderedSamples, totalTime,
+				totalTime ? (renderedSamples * 1000.0 / 44100) / totalTime : 0.0);
+	}
+
+	return Common::kNoError;
+}
+#else
+Common::Error benchmarkSID(int seconds) {
+	return Common::Error(Common::kUnknownError, "SID emulation is not included in this build");
+}
+#endif // DISABLE_SID
+
+} // End of namespace Audio
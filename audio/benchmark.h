@@ -0,0 +1,47 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_BENCHMARK_H
+#define AUDIO_BENCHMARK_H
+
+#include "common/error.h"
+#include "common/str.h"
+
+namespace Audio {
+
+/**
+ * Render a DOSBox raw OPL capture (version 2 .dro file) with the
+ * configured OPL emulator as fast as possible, and print how many times
+ * faster than real time that is.
+ */
+Common::Error benchmarkOPL(const Common::String &filename);
+
+/**
+ * Render the given number of seconds of a built-in SID register program
+ * in each sampling mode, and print how many times faster than real time
+ * that is.
+ */
+Common::Error benchmarkSID(int seconds);
+
+} // End of namespace Audio
+
+#endif
@@ -0,0 +1,68 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#include "audio/midieventqueue.h"
+
+MidiEventQueue::MidiEventQueue(uint size) : _size(size + 1), _start(0), _end(0) {
+	// One slot always stays unused to tell a full queue from an empty one
+	_events = new Event[_size];
+	memset(_events, 0, _size * sizeof(Event));
+}
+
+MidiEventQueue::~MidiEventQueue() {
+	for (uint i = 0; i < _size; ++i)
+		delete[] _events[i].sysExData;
+	delete[] _events;
+}
+
+bool MidiEventQueue::pushMessage(uint32 message) {
+	const uint next = (_end + 1) % _size;
+	if (next == _start)
+		return false;
+
+	// The consumer is done with this slot, so any SysEx data left over
+	// from its previous use can be freed now
+	Event &event = _events[_end];
+	delete[] event.sysExData;
+	event.sysExData = 0;
+	event.sysExLength = 0;
+	event.message = message;
+
+	_end = next;
+	return true;
+}
+
+bool MidiEventQueue::pushSysEx(const byte *msg, uint16 length) {
+	const uint next = (_end + 1) % _size;
+	if (next == _start)
+		return false;
+
+	Event &event = _events[_end];
+	delete[] event.sysExData;
+	event.sysExData = new byte[length];
+	memcpy(event.sysExData, msg, length);
+	event.sysExLength = length;
+	event.message = 0;
+
+	_end = next;
+	return true;
+}
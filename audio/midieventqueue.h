@@ -0,0 +1,82 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef AUDIO_MIDIEVENTQUEUE_H
+#define AUDIO_MIDIEVENTQUEUE_H
+
+#include "common/scummsys.h"
+
+/**
+ * A queue of MIDI events, passed from one producer thread to one consumer
+ * thread without locking.
+ *
+ * Software synthesizers use this to apply events on their render thread,
+ * between two rendered blocks, instead of changing the synthesizer state
+ * while it is rendering.
+ *
+ * Only one thread may push and only one thread may peek/pop at a time;
+ * several producers have to serialize their access to push*().
+ */
+class MidiEventQueue {
+public:
+	struct Event {
+		uint32 message;   ///< The short message, if sysExData is 0
+		byte *sysExData;  ///< The SysEx message, without framing
+		uint16 sysExLength;
+	};
+
+	MidiEventQueue(uint size = 1024);
+	~MidiEventQueue();
+
+	/**
+	 * Add a short message to the end of the queue.
+	 * @return false if the queue is full
+	 */
+	bool pushMessage(uint32 message);
+
+	/**
+	 * Add a copy of a SysEx message to the end of the queue.
+	 * @return false if the queue is full
+	 */
+	bool pushSysEx(const byte *msg, uint16 length);
+
+	/** Return the event at the front of the queue, or 0 if it is empty. */
+	const Event *peek() const {
+		return (_start == _end) ? 0 : &_events[_start];
+	}
+
+	/** Remove the event at the front of the queue. */
+	void pop() {
+		if (_start != _end)
+			_start = (_start + 1) % _size;
+	}
+
+	bool empty() const { return _start == _end; }
+
+private:
+	Event *_events;
+	const uint _size;
+	volatile uint _start; ///< Only written by the consumer
+	volatile uint _end;   ///< Only written by the producer
+};
+
+#endif
@@ -41,6 +41,7 @@ Paula::Paula(bool stereo, int rate, uint interruptFreq) :
 	_timerBase = 1;
 	_playing = false;
 	_end = true;
+	_interpolate = false;
 }
 
 Paula::~Paula() {
@@ -67,36 +68,86 @@ int Paula::readBuffer(int16 *buffer, const int numSamples) {
 		return numSamples;
 	}
 
-	if (_stereo)
-		return readBufferIntern<true>(buffer, numSamples);
-	else
-		return readBufferIntern<false>(buffer, numSamples);
+	if (_stereo) {
+		if (_interpolate)
+			return readBufferIntern<true, true>(buffer, numSamples);
+		else
+			return readBufferIntern<true, false>(buffer, numSamples);
+	} else {
+		if (_interpolate)
+			return readBufferIntern<false, true>(buffer, numSamples);
+		else
+			return readBufferIntern<false, false>(buffer, numSamples);
+	}
 }
 
 
-template<bool stereo>
-inline int mixBuffer(int16 *&buf, const int8 *data, Paula::Offset &offset, frac_t rate, int neededSamples, uint bufSize, byte volume, byte panning) {
-	int samples;
-	for (samples = 0; samples < neededSamples && offset.int_off < bufSize; ++samples) {
-		const int32 tmp = ((int32) data[offset.int_off]) * volume;
+/**
+ * Mix a run of samples of a single channel into the output buffer.
+ *
+ * The run ends after neededSamples samples or as soon as the offset moves
+ * past the end of the sample data, whichever happens first. Since the
+ * volume and panning stay the same for the whole run, they are combined
+ * into one factor per output channel beforehand.
+ *
+ * With interpolation enabled, the output is linearly interpolated between
+ * the current and the next source sample instead of holding the current
+ * one. nextSample is the sample which follows the last one of data.
+ */
+template<bool stereo, bool interpolate>
+inline int mixBuffer(int16 *&buf, const int8 *data, Paula::Offset &offset, frac_t rate, int neededSamples, uint bufSize, byte volume, byte panning, int8 nextSample) {
+	if (offset.int_off >= bufSize)
+		return 0;
+
+	// Compute the number of samples left before the offset passes the end
+	// of the data, so the mixing loop itself does not need to check.
+	int samples = neededSamples;
+	if (rate > 0) {
+		const uint64 left = (((uint64)(bufSize - offset.int_off)) << FRAC_BITS) - offset.rem_off;
+		const uint64 steps = (left + rate - 1) / rate;
+		if (steps < (uint64)samples)
+			samples = (int)steps;
+	}
+
+	const int32 leftVolume = volume * (255 - panning);
+	const int32 rightVolume = volume * panning;
+	uint intOff = offset.int_off;
+	frac_t remOff = offset.rem_off;
+
+	for (int i = 0; i < samples; ++i) {
+		int32 sample = data[intOff];
+		if (interpolate) {
+			const int32 next = (intOff + 1 < bufSize) ? data[intOff + 1] : nextSample;
+			sample = (sample << FRAC_BITS) + (next - sample) * remOff;
+		}
+
 		if (stereo) {
-			*buf++ += (tmp * (255 - panning)) >> 7;
-			*buf++ += (tmp * (panning)) >> 7;
-		} else
-			*buf++ += tmp;
+			if (interpolate) {
+				*buf++ += (int32)(((int64)sample * leftVolume) >> (FRAC_BITS + 7));
+				*buf++ += (int32)(((int64)sample * rightVolume) >> (FRAC_BITS + 7));
+			} else {
+				*buf++ += (sample * leftVolume) >> 7;
+				*buf++ += (sample * rightVolume) >> 7;
+			}
+		} else {
+			if (interpolate)
+				*buf++ += (sample * volume) >> FRAC_BITS;
+			else
+				*buf++ += sample * volume;
+		}
 
 		// Step to next source sample
-		offset.rem_off += rate;
-		if (offset.rem_off >= (frac_t)FRAC_ONE) {
-			offset.int_off += fracToInt(offset.rem_off);
-			offset.rem_off &= FRAC_LO_MASK;
-		}
+		remOff += rate;
+		intOff += fracToInt(remOff);
+		remOff &= FRAC_LO_MASK;
 	}
 
+	offset.int_off = intOff;
+	offset.rem_off = remOff;
 	return samples;
 }
 
-template<bool stereo>
+template<bool stereo, bool interpolate>
 int Paula::readBufferIntern(int16 *buffer, const int numSamples) {
 	int samples = _stereo ? numSamples / 2 : numSamples;
 	while (samples > 0) {
@@ -133,6 +184,10 @@ int Paula::readBufferIntern(int16 *buffer, const int numSamples) {
 			int16 *p = buffer;
 			int neededSamples = nSamples;
 
+			// Once the current data has been played, the repeat part (if any)
+			// follows. That's what gets interpolated towards at the end.
+			const int8 nextSample = (interpolate && ch.dataRepeat && ch.lengthRepeat > 2) ? ch.dataRepeat[0] : 0;
+
 			// NOTE: A Protracker (or other module format) player might actually
 			// push the offset past the sample length in its interrupt(), in which
 			// case the first mixBuffer() call should not mix anything, and the loop
@@ -142,7 +197,7 @@ int Paula::readBufferIntern(int16 *buffer, const int numSamples) {
 			// by the OS/2 version of Hopkins FBI.
 
 			// Mix the generated samples into the output buffer
-			neededSamples -= mixBuffer<stereo>(p, ch.data, ch.offset, rate, neededSamples, ch.length, ch.volume, ch.panning);
+			neededSamples -= mixBuffer<stereo, interpolate>(p, ch.data, ch.offset, rate, neededSamples, ch.length, ch.volume, ch.panning, nextSample);
 
 			// Wrap around if necessary
 			if (ch.offset.int_off >= ch.length) {
@@ -164,7 +219,7 @@ int Paula::readBufferIntern(int16 *buffer, const int numSamples) {
 				// Repeat as long as necessary.
 				while (neededSamples > 0) {
 					// Mix the generated samples into the output buffer
-					neededSamples -= mixBuffer<stereo>(p, ch.data, ch.offset, rate, neededSamples, ch.length, ch.volume, ch.panning);
+					neededSamples -= mixBuffer<stereo, interpolate>(p, ch.data, ch.offset, rate, neededSamples, ch.length, ch.volume, ch.panning, nextSample);
 
 					if (ch.offset.int_off >= ch.length) {
 						// Wrap around. See also the note above.
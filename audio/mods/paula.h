@@ -74,6 +74,17 @@ public:
 	void stopPlay() { _playing = false; }
 	void pausePlay(bool pause) { _playing = !pause; }
 
+	/**
+	 * Enable linear interpolation between source samples. This reduces the
+	 * aliasing of the plain sample-and-hold output, at the cost of some
+	 * extra CPU time. It is off by default, players usually set it from the
+	 * "amiga_interpolation" config key.
+	 */
+	void setInterpolation(bool enable) {
+		Common::StackLock lock(_mutex);
+		_interpolate = enable;
+	}
+
 // AudioStream API
 	int readBuffer(int16 *buffer, const int numSamples);
 	bool isStereo() const { return _stereo; }
@@ -197,8 +208,9 @@ private:
 	uint _curInt;
 	uint32 _timerBase;
 	bool _playing;
+	bool _interpolate;
 
-	template<bool stereo>
+	template<bool stereo, bool interpolate>
 	int readBufferIntern(int16 *buffer, const int numSamples);
 };
 
@@ -4,6 +4,7 @@ MODULE_OBJS := \
 	audiostream.o \
 	fmopl.o \
 	mididrv.o \
+	midieventqueue.o \
 	midiparser_qt.o \
 	midiparser_smf.o \
 	midiparser_xmidi.o \
@@ -38,6 +39,7 @@ MODULE_OBJS := \
 	mods/tfmx.o \
 	softsynth/adlib.o \
 	softsynth/cms.o \
+	softsynth/emumidi.o \
 	softsynth/opl/dbopl.o \
 	softsynth/opl/dosbox.o \
 	softsynth/opl/mame.o \
@@ -64,5 +66,10 @@ MODULE_OBJS += \
 	rate_arm_asm.o
 endif
 
+ifdef ENABLE_BENCHMARKS
+MODULE_OBJS += \
+	benchmark.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
@@ -0,0 +1,239 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#include "audio/softsynth/emumidi.h"
+#include "common/system.h"
+#include "common/timer.h"
+#include "common/util.h"
+
+MidiDriver_Emulated::~MidiDriver_Emulated() {
+	// The timer callback must not run on a partially destroyed driver
+	setRenderAhead(0);
+
+	delete _eventQueue;
+}
+
+void MidiDriver_Emulated::setEventQueueSize(uint size) {
+	delete _eventQueue;
+	_eventQueue = size ? new MidiEventQueue(size) : 0;
+}
+
+bool MidiDriver_Emulated::queueEvent(uint32 b) {
+	if (!_eventQueue)
+		return false;
+
+	{
+		Common::StackLock lock(_eventMutex);
+		if (_eventQueue->pushMessage(b))
+			return true;
+	}
+
+	// The queue is full, e.g. because the mixer does not pull the stream
+	// at the moment. Dropping the event could leave a note hanging, so
+	// apply the queued events and this one right away.
+	Common::StackLock synthLock(_synthMutex);
+	Common::StackLock lock(_eventMutex);
+	processEvents();
+	processEvent(b);
+	return true;
+}
+
+bool MidiDriver_Emulated::queueSysEx(const byte *msg, uint16 length) {
+	if (!_eventQueue)
+		return false;
+
+	{
+		Common::StackLock lock(_eventMutex);
+		if (_eventQueue->pushSysEx(msg, length))
+			return true;
+	}
+
+	Common::StackLock synthLock(_synthMutex);
+	Common::StackLock lock(_eventMutex);
+	processEvents();
+	processSysEx(msg, length);
+	return true;
+}
+
+void MidiDriver_Emulated::flushEvents() {
+	if (_eventQueue)
+		processEvents();
+}
+
+void MidiDriver_Emulated::processEvents() {
+	const MidiEventQueue::Event *event;
+
+	while ((event = _eventQueue->peek()) != 0) {
+		if (event->sysExData)
+			processSysEx(event->sysExData, event->sysExLength);
+		else
+			processEvent(event->message);
+
+		_eventQueue->pop();
+	}
+}
+
+void MidiDriver_Emulated::setRenderAhead(uint msecs) {
+	if (_aheadBuffer) {
+		g_system->getTimerManager()->removeTimerProc(&renderAheadProc);
+
+		Common::StackLock lock(_aheadMutex);
+		delete[] _aheadBuffer;
+		_aheadBuffer = 0;
+		_aheadSize = _aheadStart = _aheadCount = 0;
+	}
+
+	if (!msecs || !_isOpen)
+		return;
+
+	const int stereoFactor = isStereo() ? 2 : 1;
+
+	{
+		Common::StackLock lock(_aheadMutex);
+		_aheadSize = (getRate() * msecs / 1000) * stereoFactor;
+		_aheadBuffer = new int16[_aheadSize];
+	}
+
+	// Top up the buffer twice per buffered period
+	g_system->getTimerManager()->installTimerProc(&renderAheadProc, msecs * 1000 / 2, this, "MidiDriver_Emulated");
+}
+
+int MidiDriver_Emulated::readBuffer(int16 *data, const int numSamples) {
+	const int stereoFactor = isStereo() ? 2 : 1;
+
+	if (!_aheadBuffer) {
+		renderSamples(data, numSamples / stereoFactor);
+		return numSamples;
+	}
+
+	// Take whatever has been rendered ahead
+	int copied;
+	{
+		Common::StackLock lock(_aheadMutex);
+		copied = takeAhead(data, numSamples);
+	}
+
+	if (copied < numSamples) {
+		// Underrun: render the rest now. The timer callback stops after
+		// its current chunk, which has to be taken first.
+		_aheadUnderrun = true;
+		Common::StackLock renderLock(_renderMutex);
+		_aheadUnderrun = false;
+		{
+			Common::StackLock lock(_aheadMutex);
+			copied += takeAhead(data + copied, numSamples - copied);
+		}
+
+		if (copied < numSamples)
+			renderSamples(data + copied, (numSamples - copied) / stereoFactor);
+	}
+
+	return numSamples;
+}
+
+int MidiDriver_Emulated::takeAhead(int16 *data, int numSamples) {
+	int copied = 0;
+
+	while (copied < numSamples && _aheadCount > 0) {
+		int step = MIN(numSamples - copied, MIN(_aheadCount, _aheadSize - _aheadStart));
+		memcpy(data + copied, _aheadBuffer + _aheadStart, step * sizeof(int16));
+
+		copied += step;
+		_aheadCount -= step;
+		_aheadStart = (_aheadStart + step) % _aheadSize;
+	}
+
+	return copied;
+}
+
+void MidiDriver_Emulated::renderAheadProc(void *refCon) {
+	((MidiDriver_Emulated *)refCon)->renderAhead();
+}
+
+void MidiDriver_Emulated::renderAhead() {
+	const int stereoFactor = isStereo() ? 2 : 1;
+
+	// The timer runs twice per buffered period, so half the buffer keeps
+	// up with the mixer. Anything beyond that is left to the next call or
+	// to the mixer callback, instead of delaying the other timers.
+	int budget = (_aheadSize / stereoFactor / 2) * stereoFactor;
+
+	while (budget > 0 && !_aheadUnderrun) {
+		Common::StackLock renderLock(_renderMutex);
+		int start, len;
+
+		{
+			Common::StackLock lock(_aheadMutex);
+
+			if (_aheadCount >= _aheadSize)
+				break;
+
+			// Render into the free space up to the end of the ring. The
+			// mixer only consumes samples, so the space stays free.
+			start = (_aheadStart + _aheadCount) % _aheadSize;
+			len = MIN(_aheadSize - _aheadCount, _aheadSize - start);
+			len = MIN(len, MIN<int>(budget, AHEAD_CHUNK * stereoFactor));
+		}
+
+		renderSamples(_aheadBuffer + start, len / stereoFactor);
+		budget -= len;
+
+		Common::StackLock lock(_aheadMutex);
+		_aheadCount += len;
+	}
+}
+
+void MidiDriver_Emulated::renderSamples(int16 *data, int len) {
+	const int stereoFactor = isStereo() ? 2 : 1;
+	int step;
+
+	do {
+		step = len;
+		if (step > (_nextTick >> FIXP_SHIFT))
+			step = (_nextTick >> FIXP_SHIFT);
+
+		{
+			// The timer callback below must run without this lock, it
+			// may wait for engine locks held by a thread sending events
+			Common::StackLock lock(_synthMutex);
+
+			if (_eventQueue)
+				processEvents();
+
+			generateSamples(data, step);
+		}
+
+		_nextTick -= step << FIXP_SHIFT;
+		if (!(_nextTick >> FIXP_SHIFT)) {
+			if (_timerProc)
+				(*_timerProc)(_timerParam);
+
+			onTimer();
+
+			_nextTick += _samplesPerTick;
+		}
+
+		data += step * stereoFactor;
+		len -= step;
+	} while (len);
+}
@@ -25,7 +25,9 @@
 
 #include "audio/audiostream.h"
 #include "audio/mididrv.h"
+#include "audio/midieventqueue.h"
 #include "audio/mixer.h"
+#include "common/mutex.h"
 
 class MidiDriver_Emulated : public Audio::AudioStream, public MidiDriver {
 protected:
@@ -38,18 +40,94 @@ private:
 	void *_timerParam;
 
 	enum {
-		FIXP_SHIFT = 16
+		FIXP_SHIFT = 16,
+		AHEAD_CHUNK = 256 ///< Sample frames rendered ahead per hold of _renderMutex
 	};
 
 	int _nextTick;
 	int _samplesPerTick;
 
+	// Output rendered ahead of the mixer
+	int16 *_aheadBuffer;   ///< Ring buffer of rendered samples
+	int _aheadSize;        ///< Size of the ring buffer, in samples
+	int _aheadStart;       ///< Position of the oldest sample in the ring
+	int _aheadCount;       ///< Number of buffered samples
+	volatile bool _aheadUnderrun; ///< The mixer waits to render by itself
+
+	// Events passed to the render thread
+	MidiEventQueue *_eventQueue;
+	Common::Mutex _eventMutex;  ///< Serializes the producers of _eventQueue
+	Common::Mutex _renderMutex; ///< Serializes rendering, taken before _aheadMutex and _synthMutex
+	Common::Mutex _aheadMutex;  ///< Protects the ring buffer
+
+	void renderSamples(int16 *data, int len);
+	int takeAhead(int16 *data, int numSamples);
+	void renderAhead();
+	static void renderAheadProc(void *refCon);
+	void processEvents();
+
 protected:
 	int _baseFreq;
 
+	/**
+	 * Held while queued events are applied and samples are generated, but
+	 * not while the timer callback runs. Drivers take it, and call
+	 * flushEvents(), to change the synthesizer state outside of the event
+	 * queue. Taken before _eventMutex.
+	 */
+	Common::Mutex _synthMutex;
+
 	virtual void generateSamples(int16 *buf, int len) = 0;
 	virtual void onTimer() {}
 
+	/**
+	 * Apply MIDI events on the render thread instead of the thread which
+	 * sends them.
+	 *
+	 * Drivers using this pass the events received in send() and sysEx()
+	 * to queueEvent() and queueSysEx(). The events are then handed back to
+	 * processEvent() and processSysEx() before the next block is rendered,
+	 * so they never change the synthesizer state in the middle of a block.
+	 * Events thus take effect at the start of a block, which is at most one
+	 * timer tick long; sending does not make their timing any finer.
+	 *
+	 * Sending waits for other senders, but not for rendering, as long as
+	 * the queue has room. When it is full, sending takes _synthMutex, i.e.
+	 * waits for the block being rendered, and then applies the queued
+	 * events and the new one right away.
+	 *
+	 * Must be called after open() and before the driver starts playing its
+	 * stream, like setRenderAhead().
+	 *
+	 * @param size the number of events the queue can hold, or 0 to disable it
+	 */
+	void setEventQueueSize(uint size);
+
+	/**
+	 * Queue a short message for processEvent().
+	 * @return false if the event queue is disabled, the caller has to
+	 *         process the event itself then
+	 */
+	bool queueEvent(uint32 b);
+
+	/**
+	 * Queue a copy of a SysEx message for processSysEx().
+	 * @return false if the event queue is disabled
+	 */
+	bool queueSysEx(const byte *msg, uint16 length);
+
+	/**
+	 * Apply all queued events now, instead of before the next block. Must
+	 * be called with _synthMutex held.
+	 */
+	void flushEvents();
+
+	/** Apply a queued short message, called with _synthMutex held. */
+	virtual void processEvent(uint32 b) {}
+
+	/** Apply a queued SysEx message, called with _synthMutex held. */
+	virtual void processSysEx(const byte *msg, uint16 length) {}
+
 public:
 	MidiDriver_Emulated(Audio::Mixer *mixer) :
 		_mixer(mixer),
@@ -58,9 +136,17 @@ public:
 		_timerParam(0),
 		_nextTick(0),
 		_samplesPerTick(0),
+		_aheadBuffer(0),
+		_aheadSize(0),
+		_aheadStart(0),
+		_aheadCount(0),
+		_aheadUnderrun(false),
+		_eventQueue(0),
 		_baseFreq(250) {
 	}
 
+	virtual ~MidiDriver_Emulated();
+
 	// MidiDriver API
 	virtual int open() {
 		_isOpen = true;
@@ -87,35 +173,31 @@ public:
 		return 1000000 / _baseFreq;
 	}
 
-	// AudioStream API
-	virtual int readBuffer(int16 *data, const int numSamples) {
-		const int stereoFactor = isStereo() ? 2 : 1;
-		int len = numSamples / stereoFactor;
-		int step;
-
-		do {
-			step = len;
-			if (step > (_nextTick >> FIXP_SHIFT))
-				step = (_nextTick >> FIXP_SHIFT);
-
-			generateSamples(data, step);
+	/**
+	 * Render the output ahead of time from a timer callback.
+	 *
+	 * The mixer callback then mostly copies samples which were already
+	 * synthesized, so an expensive emulator does not cause mixer underruns
+	 * on slow machines. If the buffered samples run out, the rest is
+	 * rendered in the mixer callback as usual.
+	 *
+	 * The timer callback renders in small chunks and at most half the
+	 * buffer per call, so it neither holds up other timers for long nor
+	 * keeps a mixer callback which ran out of samples waiting.
+	 *
+	 * MIDI data sent from outside the driver's own timer callback takes
+	 * effect at the render position, i.e. up to the given time early.
+	 *
+	 * Must be called after open() and before the driver starts playing its
+	 * stream. Drivers using this have to disable it in close(), after
+	 * stopping the stream and before freeing any state used for rendering.
+	 *
+	 * @param msecs how much output to keep rendered ahead, or 0 to disable
+	 */
+	void setRenderAhead(uint msecs);
 
-			_nextTick -= step << FIXP_SHIFT;
-			if (!(_nextTick >> FIXP_SHIFT)) {
-				if (_timerProc)
-					(*_timerProc)(_timerParam);
-
-				onTimer();
-
-				_nextTick += _samplesPerTick;
-			}
-
-			data += step * stereoFactor;
-			len -= step;
-		} while (len);
-
-		return numSamples;
-	}
+	// AudioStream API
+	virtual int readBuffer(int16 *data, const int numSamples);
 
 	virtual bool endOfData() const {
 		return false;
@@ -25,6 +25,9 @@
 #include "common/textconsole.h"
 #include "common/util.h"
 
+// Number of samples the FM operators are evaluated in one go
+static const uint32 kOprBlockSize = 256;
+
 class TownsPC98_FmSynthOperator {
 public:
 	TownsPC98_FmSynthOperator(const uint32 timerbase, const uint32 rtt, const uint8 *rateTable,
@@ -38,6 +41,8 @@ public:
 	void updatePhaseIncrement();
 	void recalculateRates();
 	void generateOutput(int32 phasebuf, int32 *feedbuf, int32 &out);
+	void generateBlock(const int32 *phasebuf, int32 *feedbuf, int32 *out, uint32 len);
+	bool isIdle() const;
 
 	void feedbackLevel(int32 level);
 	void detune(int value);
@@ -162,7 +167,7 @@ void TownsPC98_FmSynthOperator::recalculateRates() {
 	fs_r.shift = _rshiftTbl[r + k];
 }
 
-void TownsPC98_FmSynthOperator::generateOutput(int32 phasebuf, int32 *feed, int32 &out) {
+inline void TownsPC98_FmSynthOperator::generateOutput(int32 phasebuf, int32 *feed, int32 &out) {
 	if (_state == kEnvReady)
 		return;
 
@@ -252,6 +257,21 @@ void TownsPC98_FmSynthOperator::generateOutput(int32 phasebuf, int32 *feed, int3
 	out += *o;
 }
 
+void TownsPC98_FmSynthOperator::generateBlock(const int32 *phasebuf, int32 *feedbuf, int32 *out, uint32 len) {
+	// Only a key on can wake up an idle operator and that never happens
+	// in the middle of a block.
+	if (_state == kEnvReady)
+		return;
+
+	for (uint32 i = 0; i < len; ++i)
+		generateOutput(phasebuf ? phasebuf[i] : 0, feedbuf, out[i]);
+}
+
+bool TownsPC98_FmSynthOperator::isIdle() const {
+	// An idle operator neither advances its phase nor contributes any output
+	return _state == kEnvReady;
+}
+
 void TownsPC98_FmSynthOperator::feedbackLevel(int32 level) {
 	_feedbackLevel = level ? level + 6 : 0;
 }
@@ -583,10 +603,16 @@ void TownsPC98_FmSynthSquareSineSource::nextTick(int32 *buffer, uint32 bufferSiz
 	if (!_ready)
 		return;
 
+	// The output only changes when the chip ticks, so it is recalculated
+	// for those samples only.
+	int32 finOut = 0;
+	bool updateOutput = true;
+
 	for (uint32 i = 0; i < bufferSize; i++) {
 		_timer += _tickLength;
 		while (_timer > _rtt) {
 			_timer -= _rtt;
+			updateOutput = true;
 
 			if (++_nTick >= (_noiseGenerator & 0x1f)) {
 				if ((_rand + 1) & 2)
@@ -619,23 +645,27 @@ void TownsPC98_FmSynthSquareSineSource::nextTick(int32 *buffer, uint32 bufferSiz
 				}
 			}
 			_pReslt = _evpTimer ^ _attack;
-			updateRegs();
+			if (_updateRequest != -1)
+				updateRegs();
 		}
 
-		int32 finOut = 0;
-		for (int ii = 0; ii < 3; ii++) {
-			int32 finOutTemp = ((_channels[ii].vol >> 4) & 1) ? _tleTable[_channels[ii].out ? _pReslt : 0] : _tlTable[_channels[ii].out ? (_channels[ii].vol & 0x0f) : 0];
+		if (updateOutput) {
+			updateOutput = false;
+			finOut = 0;
+			for (int ii = 0; ii < 3; ii++) {
+				int32 finOutTemp = ((_channels[ii].vol >> 4) & 1) ? _tleTable[_channels[ii].out ? _pReslt : 0] : _tlTable[_channels[ii].out ? (_channels[ii].vol & 0x0f) : 0];
 
-			if ((1 << ii) & _volMaskA)
-				finOutTemp = (finOutTemp * _volumeA) / Audio::Mixer::kMaxMixerVolume;
+				if ((1 << ii) & _volMaskA)
+					finOutTemp = (finOutTemp * _volumeA) / Audio::Mixer::kMaxMixerVolume;
 
-			if ((1 << ii) & _volMaskB)
-				finOutTemp = (finOutTemp * _volumeB) / Audio::Mixer::kMaxMixerVolume;
+				if ((1 << ii) & _volMaskB)
+					finOutTemp = (finOutTemp * _volumeB) / Audio::Mixer::kMaxMixerVolume;
 
-			finOut += finOutTemp;
-		}
+				finOut += finOutTemp;
+			}
 
-		finOut /= 3;
+			finOut /= 3;
+		}
 
 		buffer[i << 1] += finOut;
 		buffer[(i << 1) + 1] += finOut;
@@ -785,6 +815,20 @@ void TownsPC98_FmSynthPercussionSource::nextTick(int32 *buffer, uint32 bufferSiz
 	if (!_ready)
 		return;
 
+	bool active = false;
+	for (int ii = 0; ii < 6; ii++)
+		active |= _rhChan[ii].active;
+
+	// Without any playing instrument only the timer has to be kept going
+	if (!active) {
+		for (uint32 i = 0; i < bufferSize; i++) {
+			_timer += _tickLength;
+			while (_timer > _rtt)
+				_timer -= _rtt;
+		}
+		return;
+	}
+
 	for (uint32 i = 0; i < bufferSize; i++) {
 		_timer += _tickLength;
 		while (_timer > _rtt) {
@@ -860,6 +904,7 @@ TownsPC98_FmSynth::TownsPC98_FmSynth(Audio::Mixer *mixer, EmuType type, bool ext
 	_numChan(type == kType26 ? 3 : 6), _numSSG(type == kTypeTowns ? 0 : 3),
 	_hasPercussion(type == kType86 ? true : false),
 	_oprRates(0), _oprRateshift(0), _oprAttackDecay(0), _oprFrq(0), _oprSinTbl(0), _oprLevelOut(0), _oprDetune(0),
+	_renderBuffer(0), _renderBufferSize(0),
 	 _rtt(type == kTypeTowns ? 0x514767 : 0x5B8D80), _baserate(55125.0f / (float)mixer->getOutputRate()),
 	_volMaskA(0), _volMaskB(0), _volumeA(255), _volumeB(255),
 	_regProtectionFlag(false), _externalMutex(externalMutexHandling), _ready(false) {
@@ -890,6 +935,7 @@ TownsPC98_FmSynth::~TownsPC98_FmSynth() {
 	delete[] _oprSinTbl;
 	delete[] _oprLevelOut;
 	delete[] _oprDetune;
+	delete[] _renderBuffer;
 }
 
 bool TownsPC98_FmSynth::init() {
@@ -1143,8 +1189,12 @@ void TownsPC98_FmSynth::writeReg(uint8 part, uint8 regAddress, uint8 value) {
 
 int TownsPC98_FmSynth::readBuffer(int16 *buffer, const int numSamples) {
 	memset(buffer, 0, sizeof(int16) * numSamples);
-	int32 *tmp = new int32[numSamples];
-	int32 *tmpStart = tmp;
+	if (_renderBufferSize < numSamples) {
+		delete[] _renderBuffer;
+		_renderBuffer = new int32[numSamples];
+		_renderBufferSize = numSamples;
+	}
+	int32 *tmp = _renderBuffer;
 	memset(tmp, 0, sizeof(int32) * numSamples);
 	int32 samplesLeft = numSamples >> 1;
 
@@ -1218,8 +1268,6 @@ int TownsPC98_FmSynth::readBuffer(int16 *buffer, const int numSamples) {
 	if (locked)
 		_mutex.unlock();
 
-	delete[] tmpStart;
-
 	return numSamples;
 }
 
@@ -1355,96 +1403,126 @@ void TownsPC98_FmSynth::nextTick(int32 *buffer, uint32 bufferSize) {
 	if (!_ready)
 		return;
 
+	const int32 outputDivisor = (_numChan + _numSSG - 3) / 3;
+
 	for (int i = 0; i < _numChan; i++) {
-		TownsPC98_FmSynthOperator **o = _chanInternal[i].opr;
+		ChanInternal &chan = _chanInternal[i];
+		TownsPC98_FmSynthOperator **o = chan.opr;
 
-		if (_chanInternal[i].updateEnvelopeParameters) {
-			_chanInternal[i].updateEnvelopeParameters = false;
+		if (chan.updateEnvelopeParameters) {
+			chan.updateEnvelopeParameters = false;
 			for (int ii = 0; ii < 4 ; ii++)
 				o[ii]->updatePhaseIncrement();
 		}
 
-		for (uint32 ii = 0; ii < bufferSize ; ii++) {
-			int32 phbuf1, phbuf2, output;
-			phbuf1 = phbuf2 = output = 0;
+		int32 *del = &chan.feedbuf[2];
+		int32 *feed = chan.feedbuf;
 
-			int32 *leftSample = &buffer[ii * 2];
-			int32 *rightSample = &buffer[ii * 2 + 1];
-			int32 *del = &_chanInternal[i].feedbuf[2];
-			int32 *feed = _chanInternal[i].feedbuf;
+		// A channel with all four operators idle only produces silence and
+		// ends up with a cleared delay buffer, whatever the algorithm.
+		if (o[0]->isIdle() && o[1]->isIdle() && o[2]->isIdle() && o[3]->isIdle()) {
+			if (bufferSize)
+				*del = 0;
+			continue;
+		}
+
+		const bool volA = ((1 << i) & _volMaskA) != 0;
+		const bool volB = ((1 << i) & _volMaskB) != 0;
+
+		// The operators are evaluated one after another over a whole block,
+		// in the order of the connections of the channel algorithm. The only
+		// dependency between samples is the one sample delay through *del:
+		// delbuf[0] holds the delayed value from the previous block and
+		// delbuf[n + 1] receives the value written for sample n.
+		int32 phbuf1[kOprBlockSize], phbuf2[kOprBlockSize], output[kOprBlockSize];
+		int32 delbuf[kOprBlockSize + 1];
+
+		for (uint32 pos = 0; pos < bufferSize; pos += kOprBlockSize) {
+			const uint32 len = MIN<uint32>(bufferSize - pos, kOprBlockSize);
 
-			switch (_chanInternal[i].algorithm) {
+			memset(phbuf1, 0, len * sizeof(int32));
+			memset(phbuf2, 0, len * sizeof(int32));
+			memset(output, 0, len * sizeof(int32));
+			memset(delbuf + 1, 0, len * sizeof(int32));
+			delbuf[0] = *del;
+
+			switch (chan.algorithm) {
 			case 0:
-				o[0]->generateOutput(0, feed, phbuf1);
-				o[2]->generateOutput(*del, 0, phbuf2);
-				*del = 0;
-				o[1]->generateOutput(phbuf1, 0, *del);
-				o[3]->generateOutput(phbuf2, 0, output);
+				o[0]->generateBlock(0, feed, phbuf1, len);
+				o[1]->generateBlock(phbuf1, 0, delbuf + 1, len);
+				o[2]->generateBlock(delbuf, 0, phbuf2, len);
+				o[3]->generateBlock(phbuf2, 0, output, len);
+				*del = delbuf[len];
 				break;
 			case 1:
-				o[0]->generateOutput(0, feed, phbuf1);
-				o[2]->generateOutput(*del, 0, phbuf2);
-				o[1]->generateOutput(0, 0, phbuf1);
-				o[3]->generateOutput(phbuf2, 0, output);
-				*del = phbuf1;
+				o[0]->generateBlock(0, feed, delbuf + 1, len);
+				o[1]->generateBlock(0, 0, delbuf + 1, len);
+				o[2]->generateBlock(delbuf, 0, phbuf2, len);
+				o[3]->generateBlock(phbuf2, 0, output, len);
+				*del = delbuf[len];
 				break;
 			case 2:
-				o[0]->generateOutput(0, feed, phbuf2);
-				o[2]->generateOutput(*del, 0, phbuf2);
-				o[1]->generateOutput(0, 0, phbuf1);
-				o[3]->generateOutput(phbuf2, 0, output);
-				*del = phbuf1;
+				o[0]->generateBlock(0, feed, phbuf2, len);
+				o[1]->generateBlock(0, 0, delbuf + 1, len);
+				o[2]->generateBlock(delbuf, 0, phbuf2, len);
+				o[3]->generateBlock(phbuf2, 0, output, len);
+				*del = delbuf[len];
 				break;
 			case 3:
-				o[0]->generateOutput(0, feed, phbuf2);
-				o[2]->generateOutput(0, 0, *del);
-				o[1]->generateOutput(phbuf2, 0, phbuf1);
-				o[3]->generateOutput(*del, 0, output);
-				*del = phbuf1;
+				o[0]->generateBlock(0, feed, phbuf2, len);
+				o[1]->generateBlock(phbuf2, 0, delbuf + 1, len);
+				// Operator 3 adds onto the delayed output of operator 2
+				memcpy(phbuf1, delbuf, len * sizeof(int32));
+				o[2]->generateBlock(0, 0, phbuf1, len);
+				o[3]->generateBlock(phbuf1, 0, output, len);
+				*del = delbuf[len];
 				break;
 			case 4:
-				o[0]->generateOutput(0, feed, phbuf1);
-				o[2]->generateOutput(0, 0, phbuf2);
-				o[1]->generateOutput(phbuf1, 0, output);
-				o[3]->generateOutput(phbuf2, 0, output);
+				o[0]->generateBlock(0, feed, phbuf1, len);
+				o[2]->generateBlock(0, 0, phbuf2, len);
+				o[1]->generateBlock(phbuf1, 0, output, len);
+				o[3]->generateBlock(phbuf2, 0, output, len);
 				*del = 0;
 				break;
 			case 5:
-				o[0]->generateOutput(0, feed, phbuf1);
-				o[2]->generateOutput(*del, 0, output);
-				o[1]->generateOutput(phbuf1, 0, output);
-				o[3]->generateOutput(phbuf1, 0, output);
-				*del = phbuf1;
+				o[0]->generateBlock(0, feed, delbuf + 1, len);
+				o[2]->generateBlock(delbuf, 0, output, len);
+				o[1]->generateBlock(delbuf + 1, 0, output, len);
+				o[3]->generateBlock(delbuf + 1, 0, output, len);
+				*del = delbuf[len];
 				break;
 			case 6:
-				o[0]->generateOutput(0, feed, phbuf1);
-				o[2]->generateOutput(0, 0, output);
-				o[1]->generateOutput(phbuf1, 0, output);
-				o[3]->generateOutput(0, 0, output);
+				o[0]->generateBlock(0, feed, phbuf1, len);
+				o[2]->generateBlock(0, 0, output, len);
+				o[1]->generateBlock(phbuf1, 0, output, len);
+				o[3]->generateBlock(0, 0, output, len);
 				*del = 0;
 				break;
 			case 7:
-				o[0]->generateOutput(0, feed, output);
-				o[2]->generateOutput(0, 0, output);
-				o[1]->generateOutput(0, 0, output);
-				o[3]->generateOutput(0, 0, output);
+				o[0]->generateBlock(0, feed, output, len);
+				o[2]->generateBlock(0, 0, output, len);
+				o[1]->generateBlock(0, 0, output, len);
+				o[3]->generateBlock(0, 0, output, len);
 				*del = 0;
 				break;
 			};
 
-			int32 finOut = (output << 2) / ((_numChan + _numSSG - 3) / 3);
+			int32 *dst = &buffer[pos << 1];
+			for (uint32 ii = 0; ii < len; ii++) {
+				int32 finOut = (output[ii] << 2) / outputDivisor;
 
-			if ((1 << i) & _volMaskA)
-				finOut = (finOut * _volumeA) / Audio::Mixer::kMaxMixerVolume;
+				if (volA)
+					finOut = (finOut * _volumeA) / Audio::Mixer::kMaxMixerVolume;
 
-			if ((1 << i) & _volMaskB)
-				finOut = (finOut * _volumeB) / Audio::Mixer::kMaxMixerVolume;
+				if (volB)
+					finOut = (finOut * _volumeB) / Audio::Mixer::kMaxMixerVolume;
 
-			if (_chanInternal[i].enableLeft)
-				*leftSample += finOut;
+				if (chan.enableLeft)
+					dst[ii << 1] += finOut;
 
-			if (_chanInternal[i].enableRight)
-				*rightSample += finOut;
+				if (chan.enableRight)
+					dst[(ii << 1) + 1] += finOut;
+			}
 		}
 	}
 }
@@ -145,6 +145,10 @@ private:
 	int32 *_oprLevelOut;
 	int32 *_oprDetune;
 
+	// Intermediate mixing buffer of readBuffer(), kept between calls
+	int32 *_renderBuffer;
+	int _renderBufferSize;
+
 	bool _regProtectionFlag;
 
 	typedef void (TownsPC98_FmSynth::*ChipTimerProc)();
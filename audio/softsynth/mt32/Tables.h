@@ -64,6 +64,11 @@ public:
 	Bit16u exp9[512];
 	Bit16u logsin9[512];
 
+	// exp9 with the 3-bit interpolation already applied, indexed by the whole 12-bit fraction.
+	// The values are exactly those produced by LA32Utilites::interpolateExp(), the per-sample
+	// interpolation is merely replaced by a lookup.
+	Bit16u interpolatedExp9[4096];
+
 	const Bit8u *resAmpDecayFactor;
 };
 
@@ -426,16 +426,20 @@ Bits Operator::TemplateVolume(  ) {
 	return vol;
 }
 
-static const VolumeHandler VolumeHandlerTable[5] = {
-	&Operator::TemplateVolume< Operator::OFF >,
-	&Operator::TemplateVolume< Operator::RELEASE >,
-	&Operator::TemplateVolume< Operator::SUSTAIN >,
-	&Operator::TemplateVolume< Operator::DECAY >,
-	&Operator::TemplateVolume< Operator::ATTACK >
-};
-
 INLINE Bitu Operator::ForwardVolume() {
-	return currentLevel + (this->*volHandler)();
+	//Dispatch on the state directly so the envelope step can be inlined
+	switch ( state ) {
+	case RELEASE:
+		return currentLevel + TemplateVolume< RELEASE >();
+	case SUSTAIN:
+		return currentLevel + TemplateVolume< SUSTAIN >();
+	case DECAY:
+		return currentLevel + TemplateVolume< DECAY >();
+	case ATTACK:
+		return currentLevel + TemplateVolume< ATTACK >();
+	default:
+		return currentLevel + ENV_MAX;
+	}
 }
 
 
@@ -518,7 +522,6 @@ void Operator::WriteE0( const Chip* chip, Bit8u val ) {
 
 INLINE void Operator::SetState( Bit8u s ) {
 	state = s;
-	volHandler = VolumeHandlerTable[ s ];
 }
 
 INLINE bool Operator::Silent() const {
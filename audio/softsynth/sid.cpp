@@ -694,31 +694,42 @@ RESID_INLINE void Filter::updateClock(cycle_count delta_t,
 
 	// Maximum delta cycles for the filter to work satisfactorily under current
 	// cutoff frequency and resonance constraints is approximately 8.
-	cycle_count delta_t_flt = 8;
+	const cycle_count delta_t_flt = 8;
+
+	// delta_t is converted to seconds given a 1MHz clock by dividing
+	// with 1 000 000. This is done in two operations to avoid integer
+	// multiplication overflow.
+
+	// Calculate filter outputs.
+	// Vhp = Vbp/Q - Vlp - Vi;
+	// dVbp = -w0*Vhp*dt;
+	// dVlp = -w0*Vbp*dt;
+
+	// The state is kept in locals and the coefficient for full steps is
+	// computed once, which keeps this per sample loop in registers.
+	sound_sample hp = Vhp, bp = Vbp, lp = Vlp;
+	const sound_sample div_Q = _1024_div_Q;
+	sound_sample w0_delta_t = w0_ceil_dt*delta_t_flt >> 6;
 
 	while (delta_t) {
+		// The last step may be shorter
 		if (delta_t < delta_t_flt) {
-			delta_t_flt = delta_t;
+			w0_delta_t = w0_ceil_dt*delta_t >> 6;
+			delta_t = delta_t_flt;
 		}
 
-		// delta_t is converted to seconds given a 1MHz clock by dividing
-		// with 1 000 000. This is done in two operations to avoid integer
-		// multiplication overflow.
-
-		// Calculate filter outputs.
-		// Vhp = Vbp/Q - Vlp - Vi;
-		// dVbp = -w0*Vhp*dt;
-		// dVlp = -w0*Vbp*dt;
-		sound_sample w0_delta_t = w0_ceil_dt*delta_t_flt >> 6;
-
-		sound_sample dVbp = (w0_delta_t*Vhp >> 14);
-		sound_sample dVlp = (w0_delta_t*Vbp >> 14);
-		Vbp -= dVbp;
-		Vlp -= dVlp;
-		Vhp = (Vbp*_1024_div_Q >> 10) - Vlp - Vi;
+		sound_sample dVbp = (w0_delta_t*hp >> 14);
+		sound_sample dVlp = (w0_delta_t*bp >> 14);
+		bp -= dVbp;
+		lp -= dVlp;
+		hp = (bp*div_Q >> 10) - lp - Vi;
 
 		delta_t -= delta_t_flt;
 	}
+
+	Vhp = hp;
+	Vbp = bp;
+	Vlp = lp;
 }
 
 RESID_INLINE sound_sample Filter::output() {
@@ -1034,29 +1045,40 @@ RESID_INLINE void ExternalFilter::updateClock(cycle_count delta_t, sound_sample
 
 	// Maximum delta cycles for the external filter to work satisfactorily
 	// is approximately 8.
-	cycle_count delta_t_flt = 8;
+	const cycle_count delta_t_flt = 8;
+
+	// delta_t is converted to seconds given a 1MHz clock by dividing
+	// with 1 000 000.
+
+	// Calculate filter outputs.
+	// Vo  = Vlp - Vhp;
+	// Vlp = Vlp + w0lp*(Vi - Vlp)*delta_t;
+	// Vhp = Vhp + w0hp*(Vlp - Vhp)*delta_t;
+
+	sound_sample lp = Vlp, hp = Vhp, o = Vo;
+	sound_sample w0lp_delta_t = w0lp*delta_t_flt >> 8;
+	sound_sample w0hp_delta_t = w0hp*delta_t_flt;
 
 	while (delta_t) {
+		// The last step may be shorter
 		if (delta_t < delta_t_flt) {
-			delta_t_flt = delta_t;
+			w0lp_delta_t = w0lp*delta_t >> 8;
+			w0hp_delta_t = w0hp*delta_t;
+			delta_t = delta_t_flt;
 		}
 
-		// delta_t is converted to seconds given a 1MHz clock by dividing
-		// with 1 000 000.
-
-		// Calculate filter outputs.
-		// Vo  = Vlp - Vhp;
-		// Vlp = Vlp + w0lp*(Vi - Vlp)*delta_t;
-		// Vhp = Vhp + w0hp*(Vlp - Vhp)*delta_t;
-
-		sound_sample dVlp = (w0lp*delta_t_flt >> 8)*(Vi - Vlp) >> 12;
-		sound_sample dVhp = w0hp*delta_t_flt*(Vlp - Vhp) >> 20;
-		Vo = Vlp - Vhp;
-		Vlp += dVlp;
-		Vhp += dVhp;
+		sound_sample dVlp = w0lp_delta_t*(Vi - lp) >> 12;
+		sound_sample dVhp = w0hp_delta_t*(lp - hp) >> 20;
+		o = lp - hp;
+		lp += dVlp;
+		hp += dVhp;
 
 		delta_t -= delta_t_flt;
 	}
+
+	Vlp = lp;
+	Vhp = hp;
+	Vo = o;
 }
 
 RESID_INLINE sound_sample ExternalFilter::output() {
@@ -1097,7 +1119,7 @@ SID::SID() {
 	voice[1].set_sync_source(&voice[0]);
 	voice[2].set_sync_source(&voice[1]);
 
-	set_sampling_parameters(985248, 44100);
+	set_sampling_parameters(985248, SAMPLE_FAST, 44100);
 
 	bus_value = 0;
 	bus_value_ttl = 0;
@@ -1277,7 +1299,7 @@ void SID::enable_external_filter(bool enable) {
  * to slightly below 20kHz. This constraint ensures that the FIR table is
  * not overfilled.
  */
-bool SID::set_sampling_parameters(double clock_freq,
+bool SID::set_sampling_parameters(double clock_freq, sampling_method method,
 								  double sample_freq, double pass_freq,
 								  double filter_scale)
 {
@@ -1303,6 +1325,7 @@ bool SID::set_sampling_parameters(double clock_freq,
 	// Set the external filter to the pass freq
 	extfilt.set_sampling_parameter (pass_freq);
 	clock_frequency = clock_freq;
+	sampling = method;
 
 	cycles_per_sample =
 		cycle_count(clock_freq/sample_freq*(1 << FIXP_SHIFT) + 0.5);
@@ -1394,6 +1417,19 @@ void SID::updateClock(cycle_count delta_t) {
  * Fixpoint arithmetics is used.
  */
 int SID::updateClock(cycle_count& delta_t, short* buf, int n, int interleave) {
+	switch (sampling) {
+	default:
+	case SAMPLE_FAST:
+		return updateClockFast(delta_t, buf, n, interleave);
+	case SAMPLE_INTERPOLATE:
+		return updateClockInterpolate(delta_t, buf, n, interleave);
+	}
+}
+
+/**
+ * SID clocking with audio sampling - delta clocking picking nearest sample.
+ */
+int SID::updateClockFast(cycle_count& delta_t, short* buf, int n, int interleave) {
 	int s = 0;
 
 	for (;;) {
@@ -1417,6 +1453,46 @@ int SID::updateClock(cycle_count& delta_t, short* buf, int n, int interleave) {
 	return s;
 }
 
+/**
+ * SID clocking with audio sampling - delta clocking up to the cycle before
+ * each sample, then single cycle clocking with linear sample interpolation.
+ */
+int SID::updateClockInterpolate(cycle_count& delta_t, short* buf, int n, int interleave) {
+	int s = 0;
+
+	for (;;) {
+		cycle_count next_sample_offset = sample_offset + cycles_per_sample;
+		cycle_count delta_t_sample = next_sample_offset >> FIXP_SHIFT;
+		if (delta_t_sample > delta_t) {
+			break;
+		}
+		if (s >= n) {
+			return s;
+		}
+		if (delta_t_sample > 0) {
+			updateClock(delta_t_sample - 1);
+			sample_prev = output();
+			updateClock(1);
+		}
+		delta_t -= delta_t_sample;
+		sample_offset = next_sample_offset & FIXP_MASK;
+
+		short sample_now = output();
+		buf[s++*interleave] =
+			sample_prev + (sample_offset*(sample_now - sample_prev) >> FIXP_SHIFT);
+		sample_prev = sample_now;
+	}
+
+	if (delta_t > 0) {
+		updateClock(delta_t - 1);
+		sample_prev = output();
+		updateClock(1);
+	}
+	sample_offset -= delta_t << FIXP_SHIFT;
+	delta_t = 0;
+	return s;
+}
+
 }
 
 //	Plugin interface
@@ -298,6 +298,14 @@ protected:
 };
 
 
+enum sampling_method {
+	// Take the output at the cycle nearest to each sample.
+	SAMPLE_FAST,
+	// Take the output at the cycles before and after each sample and
+	// interpolate linearly, at about twice the cost.
+	SAMPLE_INTERPOLATE
+};
+
 class SID {
 public:
 	SID();
@@ -305,7 +313,7 @@ public:
 
 	void enable_filter(bool enable);
 	void enable_external_filter(bool enable);
-	bool set_sampling_parameters(double clock_freq,
+	bool set_sampling_parameters(double clock_freq, sampling_method method,
 		double sample_freq, double pass_freq = -1,
 		double filter_scale = 0.97);
 
@@ -321,6 +329,9 @@ public:
 	int output();
 
 protected:
+	int updateClockFast(cycle_count& delta_t, short* buf, int n, int interleave);
+	int updateClockInterpolate(cycle_count& delta_t, short* buf, int n, int interleave);
+
 	Voice voice[3];
 	Filter filter;
 	ExternalFilter extfilt;
@@ -335,6 +346,7 @@ protected:
 	static const int FIXP_MASK;
 
 	// Sampling variables.
+	sampling_method sampling;
 	cycle_count cycles_per_sample;
 	cycle_count sample_offset;
 	short sample_prev;
@@ -20,13 +20,15 @@
  *
  */
 
-// We use some stdio.h functionality here thus we need to allow some
-// symbols. Alternatively, we could simply allow everything by defining
+// We use some stdio.h and time functionality here thus we need to allow
+// some symbols. Alternatively, we could simply allow everything by defining
 // FORBIDDEN_SYMBOL_ALLOW_ALL
 #define FORBIDDEN_SYMBOL_EXCEPTION_FILE
 #define FORBIDDEN_SYMBOL_EXCEPTION_stdout
 #define FORBIDDEN_SYMBOL_EXCEPTION_stderr
 #define FORBIDDEN_SYMBOL_EXCEPTION_fputs
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+#define FORBIDDEN_SYMBOL_EXCEPTION_unistd_h
 
 #include "backends/modular-backend.h"
 #include "base/main.h"
@@ -40,6 +42,11 @@
 #include "audio/mixer_intern.h"
 #include "common/scummsys.h"
 
+#if defined(POSIX)
+#include <sys/time.h>
+#include <unistd.h>
+#endif
+
 /*
  * Include header files needed for the getFilesystemFactory() method.
  */
@@ -66,6 +73,11 @@ public:
 	virtual void getTimeAndDate(TimeDate &t) const {}
 
 	virtual void logMessage(LogMessageType::Type type, const char *message);
+
+private:
+#if defined(POSIX)
+	timeval _startTime;
+#endif
 };
 
 OSystem_NULL::OSystem_NULL() {
@@ -78,9 +90,20 @@ OSystem_NULL::OSystem_NULL() {
 	#else
 		#error Unknown and unsupported FS backend
 	#endif
+
+	#if defined(POSIX)
+		gettimeofday(&_startTime, 0);
+	#endif
 }
 
 OSystem_NULL::~OSystem_NULL() {
+	// The event manager refers to us as its event source, and the timer
+	// manager locks its mutex through us. Hence, both have to be deleted
+	// while we are still intact.
+	delete _eventManager;
+	_eventManager = 0;
+	delete _timerManager;
+	_timerManager = 0;
 }
 
 void OSystem_NULL::initBackend() {
@@ -105,10 +128,22 @@ bool OSystem_NULL::pollEvent(Common::Event &event) {
 }
 
 uint32 OSystem_NULL::getMillis(bool skipRecord) {
+#if defined(POSIX)
+	timeval curTime;
+
+	gettimeofday(&curTime, 0);
+
+	return (uint32)(((curTime.tv_sec - _startTime.tv_sec) * 1000) +
+			((curTime.tv_usec - _startTime.tv_usec) / 1000));
+#else
 	return 0;
+#endif
 }
 
 void OSystem_NULL::delayMillis(uint msecs) {
+#if defined(POSIX)
+	usleep(msecs * 1000);
+#endif
 }
 
 void OSystem_NULL::logMessage(LogMessageType::Type type, const char *message) {
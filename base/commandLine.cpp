@@ -42,6 +42,12 @@
 
 #include "audio/musicplugin.h"
 
+#ifdef ENABLE_BENCHMARKS
+#include "common/benchmark.h"
+#include "audio/benchmark.h"
+#include "video/benchmark.h"
+#endif
+
 #define DETECTOR_TESTING_HACK
 #define UPGRADE_ALL_TARGETS_HACK
 
@@ -68,6 +74,24 @@ static const char HELP_STRING[] =
 	"  -z, --list-games         Display list of supported games and exit\n"
 	"  -t, --list-targets       Display list of configured targets and exit\n"
 	"  --list-saves=TARGET      Display a list of savegames for the game (TARGET) specified\n"
+#ifdef ENABLE_BENCHMARKS
+	"  --bench-video=FILE       Decode all frames of the video FILE as fast as possible,\n"
+	"                           display the decoding speed and exit\n"
+	"  --bench-video-bpp=NUM    Decode the benchmarked video to 16 or 32 bits per\n"
+	"                           pixel (default: the screen format)\n"
+	"  --bench-opl=FILE         Render the DOSBox OPL capture FILE (.dro) with the\n"
+	"                           selected OPL emulator as fast as possible, display\n"
+	"                           the rendering speed and exit\n"
+	"  --bench-sid=NUM          Render NUM seconds of a built-in C64 SID program in\n"
+	"                           each sampling mode, display the rendering speed\n"
+	"                           and exit\n"
+	"  --bench-huffman=NUM      Decode NUM MB of built-in Huffman coded data from\n"
+	"                           8 and 32 bit streams with both bit orders, display\n"
+	"                           the decoding speed and exit\n"
+	"  --bench-fft=NUM          Run the FFT, RDFT and DCT transforms on NUM million\n"
+	"                           points for each transform and size, display the\n"
+	"                           transform speed and exit\n"
+#endif
 #if defined(WIN32) && !defined(_WIN32_WCE) && !defined(__SYMBIAN32__)
 	"  --console                Enable the console window (default:enabled)\n"
 #endif
@@ -194,6 +218,9 @@ void registerDefaults() {
 	ConfMan.registerDefault("native_mt32", false);
 	ConfMan.registerDefault("enable_gs", false);
 	ConfMan.registerDefault("midi_gain", 100);
+	ConfMan.registerDefault("mt32_render_ahead", 0);
+	ConfMan.registerDefault("amiga_interpolation", false);
+	ConfMan.registerDefault("c64_interpolation", false);
 
 	ConfMan.registerDefault("music_driver", "auto");
 	ConfMan.registerDefault("mt32_device", "null");
@@ -406,6 +433,28 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
 				return "list-saves";
 			END_OPTION
 
+#ifdef ENABLE_BENCHMARKS
+			DO_LONG_OPTION("bench-video")
+			END_OPTION
+
+			DO_LONG_OPTION_INT("bench-video-bpp")
+				if (strcmp(option, "16") && strcmp(option, "32"))
+					usage("Unsupported video benchmark depth '%s'", option);
+			END_OPTION
+
+			DO_LONG_OPTION("bench-opl")
+			END_OPTION
+
+			DO_LONG_OPTION_INT("bench-sid")
+			END_OPTION
+
+			DO_LONG_OPTION_INT("bench-huffman")
+			END_OPTION
+
+			DO_LONG_OPTION_INT("bench-fft")
+			END_OPTION
+#endif
+
 			DO_OPTION('c', "config")
 			END_OPTION
 
@@ -745,7 +794,6 @@ static void listAudioDevices() {
 	}
 }
 
-
 #ifdef DETECTOR_TESTING_HACK
 static void runDetectorTest() {
 	// HACK: The following code can be used to test the detection code of our
@@ -1036,4 +1084,40 @@ bool processSettings(Common::String &command, Common::StringMap &settings, Commo
 	return false;
 }
 
+bool processBenchmark(const Common::StringMap &settings, Common::Error &err) {
+	err = Common::kNoError;
+
+#ifndef DISABLE_COMMAND_LINE
+#ifdef ENABLE_BENCHMARKS
+	if (settings.contains("bench-video")) {
+		int bpp = settings.contains("bench-video-bpp") ? (int)strtol(settings["bench-video-bpp"].c_str(), 0, 10) : 0;
+		err = Video::benchmarkVideo(settings["bench-video"], bpp);
+		return true;
+	}
+
+	if (settings.contains("bench-opl")) {
+		err = Audio::benchmarkOPL(settings["bench-opl"]);
+		return true;
+	}
+
+	if (settings.contains("bench-sid")) {
+		err = Audio::benchmarkSID((int)strtol(settings["bench-sid"].c_str(), 0, 10));
+		return true;
+	}
+
+	if (settings.contains("bench-huffman")) {
+		err = Common::benchmarkHuffman((int)strtol(settings["bench-huffman"].c_str(), 0, 10));
+		return true;
+	}
+
+	if (settings.contains("bench-fft")) {
+		err = Common::benchmarkFFT((int)strtol(settings["bench-fft"].c_str(), 0, 10));
+		return true;
+	}
+#endif
+#endif // DISABLE_COMMAND_LINE
+
+	return false;
+}
+
 } // End of namespace Base
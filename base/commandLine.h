@@ -55,6 +55,18 @@ Common::String parseCommandLine(Common::StringMap &settings, int argc, const cha
  */
 bool processSettings(Common::String &command, Common::StringMap &settings, Common::Error &err);
 
+/**
+ * Run a benchmark, if one was requested on the command line. The benchmarks
+ * are only built with the --enable-benchmarks configure option.
+ * Unlike the commands handled by processSettings(), this needs an initialized
+ * backend.
+ *
+ * @param[in] settings	the settings as returned by parseCommandLine
+ * @param[out] err		indicates whether any error occurred, and which
+ * @return true if a benchmark was run and ScummVM should quit, false otherwise
+ */
+bool processBenchmark(const Common::StringMap &settings, Common::Error &err);
+
 } // End of namespace Base
 
 #endif
@@ -407,6 +407,14 @@ extern "C" int scummvm_main(int argc, const char * const argv[]) {
 	// the command line params) was read.
 	system.initBackend();
 
+	// The benchmarks only need the backend, so run them before
+	// setting up anything else
+	if (Base::processBenchmark(settings, res)) {
+		if (res.getCode() != Common::kNoError)
+			warning("%s", res.getDesc().c_str());
+		return res.getCode();
+	}
+
 	// If we received an invalid graphics mode parameter via command line
 	// we check this here. We can't do it until after the backend is inited,
 	// or there won't be a graphics manager to ask for the supported modes.
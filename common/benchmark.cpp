@@ -0,0 +1,199 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// FIXME: Avoid using printf
+#define FORBIDDEN_SYMBOL_EXCEPTION_printf
+
+#include "common/benchmark.h"
+#include "common/array.h"
+#include "common/bitstream.h"
+#include "common/dct.h"
+#include "common/fft.h"
+#include "common/huffman.h"
+#include "common/memstream.h"
+#include "common/rdft.h"
+#include "common/system.h"
+
+namespace Common {
+
+/**
+ * Build a complete prefix code of 510 symbols with lengths from 2 to 15
+ * bits. The codes come in 8 classes: class c starts with c one bits and a
+ * zero bit (the last class has no zero bit), followed by c + 1 bits which
+ * select the symbol within the class. Random data decodes to codes of
+ * about 4 bits on average then, one in 16 of them longer than the lookup
+ * table of the decoder.
+ */
+static void buildBenchmarkCode(bool msb, Array<uint32> &codes, Array<uint8> &lengths) {
+	const uint32 classCount = 8;
+
+	for (uint32 c = 0; c < classCount; c++) {
+		const uint32 ones = (1 << c) - 1;
+		const uint32 prefixLength = (c < classCount - 1) ? c + 1 : c;
+		const uint32 suffixLength = c + 1;
+
+		for (uint32 s = 0; s < (1u << suffixLength); s++) {
+			// BitStream::addBit() collects the bits of MSB first streams from
+			// the top, those of LSB first streams from the bottom
+			if (msb)
+				codes.push_back((((c < classCount - 1) ? (ones << 1) : ones) << suffixLength) | s);
+			else
+				codes.push_back(ones | (s << prefixLength));
+
+			lengths.push_back(prefixLength + suffixLength);
+		}
+	}
+}
+
+static uint32 decodeBenchmarkData(const Huffman &huffman, BitStream &bits) {
+	// Stop before the end of the data, so that the last code is complete
+	const uint32 end = bits.size() - 15;
+	uint32 count = 0;
+
+	while (bits.pos() < end) {
+		huffman.getSymbol(bits);
+		count++;
+	}
+
+	return count;
+}
+
+Error benchmarkHuffman(int megabytes) {
+	if (megabytes <= 0 || megabytes > 1024)
+		return Error(kUnknownError, "Invalid Huffman benchmark size");
+
+	const uint32 size = megabytes * 1024 * 1024;
+	byte *data = new byte[size];
+
+	uint32 seed = 1;
+	for (uint32 i = 0; i < size; i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = seed >> 16;
+	}
+
+	static const char *const streamNames[] = { "8-bit MSB first", "8-bit LSB first", "32-bit MSB first", "32-bit LSB first" };
+
+	for (int type = 0; type < ARRAYSIZE(streamNames); type++) {
+		const bool msb = (type % 2) == 0;
+
+		Array<uint32> codes;
+		Array<uint8> lengths;
+		buildBenchmarkCode(msb, codes, lengths);
+
+		Huffman huffman(0, codes.size(), &codes[0], &lengths[0]);
+		MemoryReadStream stream(data, size);
+
+		const uint32 startTime = g_system->getMillis();
+
+		uint32 count;
+		if (type == 0) {
+			BitStream8MSB bits(stream);
+			count = decodeBenchmarkData(huffman, bits);
+		} else if (type == 1) {
+			BitStream8LSB bits(stream);
+			count = decodeBenchmarkData(huffman, bits);
+		} else if (type == 2) {
+			BitStream32LEMSB bits(stream);
+			count = decodeBenchmarkData(huffman, bits);
+		} else {
+			BitStream32LELSB bits(stream);
+			count = decodeBenchmarkData(huffman, bits);
+		}
+
+		const uint32 totalTime = g_system->getMillis() - startTime;
+
+		printf("%-16s %d symbols from %d MB in %d ms (%.1f MB/s, %.1f million symbols/s)\n",
+				streamNames[type], count, megabytes, totalTime,
+				totalTime ? megabytes * 1000.0 / totalTime : 0.0,
+				totalTime ? count / 1000.0 / totalTime : 0.0);
+	}
+
+	delete[] data;
+	return kNoError;
+}
+
+Error benchmarkFFT(int megapoints) {
+	if (megapoints <= 0 || megapoints > 1000)
+		return Error(kUnknownError, "Invalid FFT benchmark size");
+
+	// The transforms and sizes used by the Bink and QDM2 audio decoders
+	static const char *const transformNames[] = { "FFT", "RDFT DFT_C2R", "RDFT IDFT_C2R", "DCT III" };
+	static const int sizeBits[] = { 7, 9, 11 };
+
+	const int maxSize = 1 << sizeBits[ARRAYSIZE(sizeBits) - 1];
+	float *input = new float[maxSize * 2];
+	float *data = new float[maxSize * 2];
+
+	uint32 seed = 1;
+	for (int i = 0; i < maxSize * 2; i++) {
+		seed = seed * 1103515245 + 12345;
+		input[i] = (int16)(seed >> 16) / 32768.0f;
+	}
+
+	for (int type = 0; type < ARRAYSIZE(transformNames); type++) {
+		for (int s = 0; s < ARRAYSIZE(sizeBits); s++) {
+			const int bits = sizeBits[s];
+			const int size = 1 << bits;
+			const int count = megapoints * 1000000 / size;
+
+			// FFT works on complex numbers, the others on real ones
+			const int floats = (type == 0) ? size * 2 : size;
+
+			FFT *fft = (type == 0) ? new FFT(bits, 0) : 0;
+			RDFT *rdft = (type == 1 || type == 2) ? new RDFT(bits, (type == 1) ? RDFT::DFT_C2R : RDFT::IDFT_C2R) : 0;
+			DCT *dct = (type == 3) ? new DCT(bits, DCT::DCT_III) : 0;
+
+			const uint32 startTime = g_system->getMillis();
+
+			for (int i = 0; i < count; i++) {
+				// Start from the same input every time, so the values
+				// neither grow nor die out over the iterations
+				memcpy(data, input, floats * sizeof(float));
+
+				if (fft) {
+					fft->permute((Complex *)data);
+					fft->calc((Complex *)data);
+				} else if (rdft) {
+					rdft->calc(data);
+				} else {
+					dct->calc(data);
+				}
+			}
+
+			const uint32 totalTime = g_system->getMillis() - startTime;
+
+			printf("%-13s %4d points: %d transforms in %d ms (%.1f million points/s)\n",
+					transformNames[type], size, count, totalTime,
+					totalTime ? (double)count * size / 1000.0 / totalTime : 0.0);
+
+			delete fft;
+			delete rdft;
+			delete dct;
+		}
+	}
+
+	delete[] input;
+	delete[] data;
+	return kNoError;
+}
+
+} // End of namespace Common
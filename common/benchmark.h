@@ -0,0 +1,49 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef COMMON_BENCHMARK_H
+#define COMMON_BENCHMARK_H
+
+#include "common/error.h"
+
+namespace Common {
+
+/**
+ * Decode the given number of megabytes of pseudo-random Huffman coded
+ * data from 8-bit and 32-bit streams with both bit orders, and print the
+ * decoding speed.
+ *
+ * This is not part of test/common/huffman.h, since the test runner has no
+ * OSystem and thus no clock to time the decoding with.
+ */
+Error benchmarkHuffman(int megabytes);
+
+/**
+ * Run the FFT, RDFT and DCT transforms used by the audio decoders on the
+ * given number of million points for each transform and size, and print
+ * the transform speed.
+ */
+Error benchmarkFFT(int megapoints);
+
+} // End of namespace Common
+
+#endif
@@ -28,6 +28,7 @@
 #include "common/scummsys.h"
 #include "common/textconsole.h"
 #include "common/stream.h"
+#include "common/util.h"
 
 namespace Common {
 
@@ -67,6 +68,9 @@ public:
 	/** Add a bit to the value x, making it an n+1-bit value. */
 	virtual void addBit(uint32 &x, uint32 n) = 0;
 
+	/** Are the bits of each data value handed out from MSB to LSB? */
+	virtual bool isMSBFirst() const = 0;
+
 protected:
 	BitStream() {
 	}
@@ -191,17 +195,31 @@ public:
 		if (n > 32)
 			error("BitStreamImpl::getBits(): Too many bits requested to be read");
 
-		// Read the number of bits
+		// Read the number of bits, taking as many as possible out of
+		// the current value at once
 		uint32 v = 0;
+		uint8 shift = 0;
 
-		if (isMSB2LSB) {
-			while (n-- > 0)
-				v = (v << 1) | getBit();
-		} else {
-			for (uint32 i = 0; i < n; i++)
-				v = (v >> 1) | (((uint32) getBit()) << 31);
+		while (n > 0) {
+			// Check if we need the next value
+			if (_inValue == 0)
+				readValue();
+
+			const uint8 m = MIN<uint8>(n, valueBits - _inValue);
+
+			if (isMSB2LSB) {
+				v = (m == 32) ? (_value >> (32 - m)) : ((v << m) | (_value >> (32 - m)));
+				_value = (m == 32) ? 0 : (_value << m);
+			} else {
+				v |= ((m == 32) ? _value : (_value & ((1u << m) - 1))) << shift;
+				_value = (m == 32) ? 0 : (_value >> m);
+			}
 
-			v >>= (32 - n);
+			shift += m;
+			n -= m;
+
+			// Increase the position within the current value
+			_inValue = (_inValue + m) % valueBits;
 		}
 
 		return v;
@@ -228,6 +246,14 @@ public:
 	 * The bit order is the same as in getBits().
 	 */
 	uint32 peekBits(uint8 n) {
+		// The bits are all in the current value, no need to touch the data stream
+		if (_inValue != 0 && n > 0 && n <= (valueBits - _inValue)) {
+			if (isMSB2LSB)
+				return _value >> (32 - n);
+			else
+				return (n == 32) ? _value : (_value & ((1u << n) - 1));
+		}
+
 		uint32 value   = _value;
 		uint8  inValue = _inValue;
 		uint32 curPos  = _stream->pos();
@@ -262,6 +288,10 @@ public:
 			x = (x & ~(1 << n)) | (getBit() << n);
 	}
 
+	bool isMSBFirst() const {
+		return isMSB2LSB;
+	}
+
 	/** Rewind the bit stream back to the start. */
 	void rewind() {
 		_stream->seek(0);
@@ -272,8 +302,26 @@ public:
 
 	/** Skip the specified amount of bits. */
 	void skip(uint32 n) {
-		while (n-- > 0)
-			getBit();
+		// Finish the current value
+		if (_inValue != 0) {
+			const uint8 m = MIN<uint32>(n, valueBits - _inValue);
+			getBits(m);
+			n -= m;
+		}
+
+		// Skip whole values directly in the data stream
+		const uint32 values = n / valueBits;
+		if (values > 0) {
+			if ((size() - pos()) < values * valueBits)
+				error("BitStreamImpl::skip(): End of bit stream reached");
+
+			_stream->skip(values * (valueBits >> 3));
+			n -= values * valueBits;
+		}
+
+		// And the remaining bits of the last value
+		if (n > 0)
+			getBits(n);
 	}
 
 	/** Return the stream position in bits. */
@@ -39,7 +39,6 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 	int n = 1 << bits;
 
 	_tmpBuf = new Complex[n];
-	_expTab = new Complex[n / 2];
 	_revTab = new uint16[n];
 
 	_splitRadix = 1;
@@ -56,8 +55,10 @@ FFT::FFT(int bits, int inverse) : _bits(bits), _inverse(inverse) {
 }
 
 FFT::~FFT() {
+	for (int i = 0; i < ARRAYSIZE(_cosTables); i++)
+		delete _cosTables[i];
+
 	delete[] _revTab;
-	delete[] _expTab;
 	delete[] _tmpBuf;
 }
 
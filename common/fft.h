@@ -63,7 +63,6 @@ private:
 
 	uint16 *_revTab;
 
-	Complex *_expTab;
 	Complex *_tmpBuf;
 
 	int _splitRadix;
@@ -58,6 +58,43 @@ Huffman::Huffman(uint8 maxLength, uint32 codeCount, const uint32 *codes, const u
 		// And put the pointer to the symbol/code struct into the symbol list.
 		_symbols[i] = &_codes[lengths[i] - 1].back();
 	}
+
+	buildLookupTables();
+}
+
+void Huffman::buildLookupTables() {
+	_lookupBits = MIN<uint8>(_codes.size(), kLookupBits);
+
+	_lookupMSB.resize(1 << _lookupBits);
+	_lookupLSB.resize(1 << _lookupBits);
+
+	// Go through the codes from shortest to longest, and never overwrite an
+	// entry. That way, the lookup finds the same code as the bitwise search.
+	for (uint8 length = 1; length <= _lookupBits; length++) {
+		const uint32 fill = 1 << (_lookupBits - length);
+
+		for (CodeList::const_iterator cCode = _codes[length - 1].begin(); cCode != _codes[length - 1].end(); ++cCode) {
+			// Such a code can never be matched
+			if (cCode->code >> length)
+				continue;
+
+			for (uint32 i = 0; i < fill; i++) {
+				// With MSB2LSB streams, the code makes up the top bits of the index
+				LookupEntry &msb = _lookupMSB[(cCode->code << (_lookupBits - length)) | i];
+				if (msb.length == 0) {
+					msb.symbol = &*cCode;
+					msb.length = length;
+				}
+
+				// With LSB2MSB streams, the code makes up the bottom bits of the index
+				LookupEntry &lsb = _lookupLSB[cCode->code | (i << length)];
+				if (lsb.length == 0) {
+					lsb.symbol = &*cCode;
+					lsb.length = length;
+				}
+			}
+		}
+	}
 }
 
 Huffman::~Huffman() {
@@ -69,9 +106,26 @@ void Huffman::setSymbols(const uint32 *symbols) {
 }
 
 uint32 Huffman::getSymbol(BitStream &bits) const {
-	uint32 code = 0;
+	// Close to the end of the stream we can't peek the full amount of bits
+	if ((bits.size() - bits.pos()) < _lookupBits)
+		return searchSymbol(bits, 0, 0);
+
+	const uint32 index = bits.peekBits(_lookupBits);
+	const LookupEntry &entry = bits.isMSBFirst() ? _lookupMSB[index] : _lookupLSB[index];
+
+	if (entry.length != 0) {
+		bits.skip(entry.length);
+		return entry.symbol->symbol;
+	}
+
+	// No short code matched, so this has to be a long one. The peeked bits
+	// are exactly what the bitwise search would have collected so far.
+	bits.skip(_lookupBits);
+	return searchSymbol(bits, index, _lookupBits);
+}
 
-	for (uint32 i = 0; i < _codes.size(); i++) {
+uint32 Huffman::searchSymbol(BitStream &bits, uint32 code, uint32 length) const {
+	for (uint32 i = length; i < _codes.size(); i++) {
 		bits.addBit(code, i);
 
 		for (CodeList::const_iterator cCode = _codes[i].begin(); cCode != _codes[i].end(); ++cCode)
@@ -36,6 +36,9 @@ class BitStream;
 /**
  * Huffman bitstream decoding
  *
+ * Codes of up to kLookupBits bits are resolved with a single table lookup,
+ * longer codes are searched for bit by bit.
+ *
  * Used in engines:
  *  - scumm
  */
@@ -59,6 +62,9 @@ public:
 	uint32 getSymbol(BitStream &bits) const;
 
 private:
+	/** Maximal number of bits looked up at once. */
+	static const uint8 kLookupBits = 9;
+
 	struct Symbol {
 		uint32 code;
 		uint32 symbol;
@@ -66,15 +72,37 @@ private:
 		Symbol(uint32 c, uint32 s);
 	};
 
+	/** An entry in the lookup tables. A length of 0 means there's no short code for these bits. */
+	struct LookupEntry {
+		const Symbol *symbol;
+		uint8 length;
+
+		LookupEntry() : symbol(0), length(0) {}
+	};
+
 	typedef List<Symbol> CodeList;
 	typedef Array<CodeList> CodeLists;
 	typedef Array<Symbol *> SymbolList;
+	typedef Array<LookupEntry> LookupTable;
 
 	/** Lists of codes and their symbols, sorted by code length. */
 	CodeLists _codes;
 
 	/** Sorted list of pointers to the symbols. */
 	SymbolList _symbols;
+
+	/** Number of bits used to index the lookup tables. */
+	uint8 _lookupBits;
+
+	/** Short codes, indexed by the next _lookupBits bits of an MSB2LSB bit stream. */
+	LookupTable _lookupMSB;
+	/** Short codes, indexed by the next _lookupBits bits of an LSB2MSB bit stream. */
+	LookupTable _lookupLSB;
+
+	void buildLookupTables();
+
+	/** Search for the symbol bit by bit, continuing with a code of the given length. */
+	uint32 searchSymbol(BitStream &bits, uint32 code, uint32 length) const;
 };
 
 } // End of namespace Common
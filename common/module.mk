@@ -56,5 +56,10 @@ MODULE_OBJS += \
 	recorderfile.o
 endif
 
+ifdef ENABLE_BENCHMARKS
+MODULE_OBJS += \
+	benchmark.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
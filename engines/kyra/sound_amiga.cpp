@@ -23,6 +23,8 @@
 #include "kyra/sound_intern.h"
 #include "kyra/resource.h"
 
+#include "common/config-manager.h"
+
 #include "audio/mixer.h"
 #include "audio/mods/maxtrax.h"
 
@@ -46,6 +48,7 @@ SoundAmiga::~SoundAmiga() {
 
 bool SoundAmiga::init() {
 	_driver = new Audio::MaxTrax(_mixer->getOutputRate(), true);
+	_driver->setInterpolation(ConfMan.getBool("amiga_interpolation"));
 
 	_tableSfxIntro = _vm->staticres()->loadAmigaSfxTable(k1AmigaIntroSFXTable, _tableSfxIntro_Size);
 	_tableSfxGame = _vm->staticres()->loadAmigaSfxTable(k1AmigaGameSFXTable, _tableSfxGame_Size);
@@ -42,6 +42,13 @@ reg_t kLoad(EngineState *s, int argc, reg_t *argv) {
 	if (restype == kResourceTypeMemory)
 		return s->_segMan->allocateHunkEntry("kLoad()", resnr);
 
+	// Rooms load the resources they are going to use while initializing, so
+	// read and decompress them now instead of when they are first drawn or
+	// played.
+	g_sci->getResMan()->prefetchResource(ResourceId(restype, resnr));
+	if (restype == kResourceTypeScript)
+		g_sci->getResMan()->prefetchResource(ResourceId(kResourceTypeHeap, resnr));
+
 	return make_reg(0, ((restype << 11) | resnr)); // Return the resource identifier as handle
 }
 
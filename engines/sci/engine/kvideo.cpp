@@ -52,6 +52,9 @@ void playVideo(Video::VideoDecoder *videoDecoder, VideoState videoState) {
 
 	videoDecoder->start();
 
+	// Spread the cost of expensive frames over the waits between frames
+	videoDecoder->setDecodeAhead(2);
+
 	byte *scaleBuffer = 0;
 	byte bytesPerPixel = videoDecoder->getPixelFormat().bytesPerPixel;
 	uint16 width = videoDecoder->getWidth();
@@ -116,6 +119,8 @@ void playVideo(Video::VideoDecoder *videoDecoder, VideoState videoState) {
 
 				g_system->updateScreen();
 			}
+		} else {
+			videoDecoder->decodeAheadFrame();
 		}
 
 		Common::Event event;
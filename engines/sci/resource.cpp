@@ -22,6 +22,7 @@
 
 // Resource library
 
+#include "common/config-manager.h"
 #include "common/file.h"
 #include "common/fs.h"
 #include "common/macresman.h"
@@ -189,6 +190,7 @@ Resource::Resource(ResourceManager *resMan, ResourceId id) : _resMan(resMan), _i
 	_fileOffset = 0;
 	_status = kResStatusNoMalloc;
 	_lockers = 0;
+	_packed = false;
 	_source = NULL;
 	_header = NULL;
 	_headerSize = 0;
@@ -861,6 +863,9 @@ ResourceManager::ResourceManager() {
 void ResourceManager::init(bool initFromFallbackDetector) {
 	_memoryLocked = 0;
 	_memoryLRU = 0;
+	_maxMemoryLRU = kDefaultMaxMemoryLRU;
+	if (ConfMan.hasKey("resource_cache_size"))
+		_maxMemoryLRU = CLIP<int>(ConfMan.getInt("resource_cache_size"), 0, kMaxResourceCacheSize) * 1024;
 	_LRU.clear();
 	_resMap.clear();
 	_audioMapSCI1 = NULL;
@@ -1002,9 +1007,21 @@ void ResourceManager::printLRU() {
 }
 
 void ResourceManager::freeOldResources() {
-	while (MAX_MEMORY < _memoryLRU) {
+	while (_maxMemoryLRU < _memoryLRU) {
 		assert(!_LRU.empty());
-		Resource *goner = *_LRU.reverse_begin();
+
+		// Reading a resource which is stored uncompressed again is cheap, so
+		// free the oldest of those first. Resources which had to be
+		// decompressed are only freed if the oldest ones all are.
+		Common::List<Resource *>::iterator it = _LRU.reverse_begin();
+		Resource *goner = *it;
+		for (int i = 0; i < kEvictionWindow && it != _LRU.end(); ++i, --it) {
+			if (!(*it)->_packed) {
+				goner = *it;
+				break;
+			}
+		}
+
 		removeFromLRU(goner);
 		goner->unalloc();
 #ifdef SCI_VERBOSE_RESMAN
@@ -1061,6 +1078,30 @@ Resource *ResourceManager::findResource(ResourceId id, bool lock) {
 	}
 }
 
+void ResourceManager::prefetchResource(ResourceId id) {
+	switch (id.getType()) {
+	case kResourceTypeView:
+	case kResourceTypePic:
+	case kResourceTypeSound:
+	case kResourceTypeScript:
+	case kResourceTypeHeap:
+		break;
+	default:
+		return;
+	}
+
+	Resource *res = testResource(id);
+	if (!res || res->_status != kResStatusNoMalloc)
+		return;
+
+	loadResource(res);
+	if (res->_status != kResStatusAllocated)
+		return;
+
+	addToLRU(res);
+	freeOldResources();
+}
+
 void ResourceManager::unlockResource(Resource *res) {
 	assert(res);
 
@@ -1976,6 +2017,7 @@ int Resource::decompress(ResVersion volVersion, Common::SeekableReadStream *file
 
 	data = new byte[size];
 	_status = kResStatusAllocated;
+	_packed = (compression != kCompNone);
 	errorNum = data ? dec->unpack(file, data, szPacked, size) : SCI_ERROR_RESOURCE_TOO_BIG;
 	if (errorNum)
 		unalloc();
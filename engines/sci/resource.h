@@ -271,6 +271,7 @@ protected:
 	int32 _fileOffset; /**< Offset in file */
 	ResourceStatus _status;
 	uint16 _lockers; /**< Number of places where this resource was locked */
+	bool _packed; /**< Whether the resource had to be decompressed when it was loaded */
 	ResourceSource *_source;
 	ResourceManager *_resMan;
 
@@ -333,6 +334,14 @@ public:
 	 */
 	void unlockResource(Resource *res);
 
+	/**
+	 * Loads a resource ahead of its first use, without locking it. Views,
+	 * pics, sounds and scripts are read and decompressed right away, so
+	 * they are already in memory when the game actually needs them.
+	 * @param id	The resource to load
+	 */
+	void prefetchResource(ResourceId id);
+
 	/**
 	 * Tests whether a resource exists.
 	 *
@@ -410,18 +419,26 @@ public:
 	ResourceType convertResType(byte type);
 
 protected:
-	// Maximum number of bytes to allow being allocated for resources
-	// Note: maxMemory will not be interpreted as a hard limit, only as a restriction
-	// for resources which are not explicitly locked. However, a warning will be
-	// issued whenever this limit is exceeded.
+	// Default number of bytes to allow being allocated for resources, can be
+	// changed with the "resource_cache_size" setting (in KB). Platforms with
+	// little memory keep the original small cache.
+	// Note: this will not be interpreted as a hard limit, only as a restriction
+	// for resources which are not explicitly locked.
 	enum {
-		MAX_MEMORY = 256 * 1024	// 256KB
+#ifdef REDUCE_MEMORY_USAGE
+		kDefaultMaxMemoryLRU = 256 * 1024,	// 256KB
+#else
+		kDefaultMaxMemoryLRU = 8 * 1024 * 1024,	// 8MB
+#endif
+		kMaxResourceCacheSize = 1024 * 1024,	///< Upper limit of the "resource_cache_size" setting, in KB (1GB)
+		kEvictionWindow = 8	///< Number of least recently used resources to pick a victim from
 	};
 
 	ViewType _viewType; // Used to determine if the game has EGA or VGA graphics
 	Common::List<ResourceSource *> _sources;
 	int _memoryLocked;	///< Amount of resource bytes in locked memory
 	int _memoryLRU;		///< Amount of resource bytes under LRU control
+	int _maxMemoryLRU;	///< Maximum amount of resource bytes under LRU control
 	Common::List<Resource *> _LRU; ///< Last Resource Used list
 	ResourceMap _resMap;
 	Common::List<Common::File *> _volumeFiles; ///< list of opened volume files
@@ -66,6 +66,7 @@ public:
 
 	// MidiDriver_Emulated
 	void generateSamples(int16 *buf, int len);
+	void processEvent(uint32 b);
 
 	void setVolume(byte volume);
 	void playSwitch(bool play);
@@ -241,6 +242,9 @@ int MidiDriver_AdLib::openAdLib(bool isSCI0) {
 
 	MidiDriver_Emulated::open();
 
+	// The game thread sends events while the mixer thread renders
+	setEventQueueSize(1024);
+
 	_mixer->playStream(Audio::Mixer::kPlainSoundType, &_mixerSoundHandle, this, -1, _mixer->kMaxChannelVolume, 0, DisposeAfterUse::NO);
 
 	return 0;
@@ -254,12 +258,22 @@ void MidiDriver_AdLib::close() {
 }
 
 void MidiDriver_AdLib::setVolume(byte volume) {
+	// Keep the change in order with the queued events, and off the voices
+	// while the mixer thread renders them
+	Common::StackLock lock(_synthMutex);
+	flushEvents();
+
 	_masterVolume = volume;
 	renewNotes(-1, true);
 }
 
-// MIDI messages can be found at http://www.midi.org/techspecs/midimessages.php
 void MidiDriver_AdLib::send(uint32 b) {
+	if (!queueEvent(b))
+		processEvent(b);
+}
+
+// MIDI messages can be found at http://www.midi.org/techspecs/midimessages.php
+void MidiDriver_AdLib::processEvent(uint32 b) {
 	byte command = b & 0xf0;
 	byte channel = b & 0xf;
 	byte op1 = (b >> 8) & 0xff;
@@ -743,6 +757,9 @@ void MidiDriver_AdLib::setRegister(int reg, int value, int channels) {
 }
 
 void MidiDriver_AdLib::playSwitch(bool play) {
+	Common::StackLock lock(_synthMutex);
+	flushEvents();
+
 	_playSwitch = play;
 	renewNotes(-1, play);
 }
@@ -779,8 +796,11 @@ bool MidiDriver_AdLib::loadResource(const byte *data, uint size) {
 uint32 MidiDriver_AdLib::property(int prop, uint32 param) {
 	switch(prop) {
 	case MIDI_PROP_MASTER_VOLUME:
-		if (param != 0xffff)
+		if (param != 0xffff) {
+			Common::StackLock lock(_synthMutex);
+			flushEvents();
 			_masterVolume = param;
+		}
 		return _masterVolume;
 	default:
 		break;
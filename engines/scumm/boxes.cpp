@@ -87,6 +87,18 @@ struct Box {				/* Internal walkbox file format */
 
 
 static void getGates(const BoxCoords &box1, const BoxCoords &box2, Common::Point gateA[2], Common::Point gateB[2]);
+static bool boxesTouch(BoxCoords box2, BoxCoords box);
+
+static void appendBoxCoords(Common::Array<int16> &key, const BoxCoords &box) {
+	key.push_back(box.ul.x);
+	key.push_back(box.ul.y);
+	key.push_back(box.ur.x);
+	key.push_back(box.ur.y);
+	key.push_back(box.ll.x);
+	key.push_back(box.ll.y);
+	key.push_back(box.lr.x);
+	key.push_back(box.lr.y);
+}
 
 static bool compareSlope(const Common::Point &p1, const Common::Point &p2, const Common::Point &p3) {
 	return (p2.y - p1.y) * (p3.x - p1.x) <= (p3.y - p1.y) * (p2.x - p1.x);
@@ -719,19 +731,27 @@ int ScummEngine::getNextBox(byte from, byte to) {
 	boxm = getBoxMatrixBaseAddr();
 
 	if (_game.version == 0) {
-		// calculate shortest paths
-		byte *itineraryMatrix = (byte *)malloc(numOfBoxes * numOfBoxes);
-		calcItineraryMatrix(itineraryMatrix, numOfBoxes);
+		// The shortest paths only depend on the box matrix of the room, so
+		// they are only calculated again once that changes.
+		const byte *matrix = getResourceAddress(rtMatrix, 1);
+		const uint32 matrixSize = getResourceSize(rtMatrix, 1);
+		if (_v0ItineraryMatrix.size() != (uint)(numOfBoxes * numOfBoxes) ||
+				_v0ItinerarySource.size() != matrixSize ||
+				memcmp(_v0ItinerarySource.begin(), matrix, matrixSize)) {
+			_v0ItinerarySource.resize(matrixSize);
+			memcpy(_v0ItinerarySource.begin(), matrix, matrixSize);
+			_v0ItineraryMatrix.resize(numOfBoxes * numOfBoxes);
+			calcItineraryMatrix(_v0ItineraryMatrix.begin(), numOfBoxes);
+		}
 
 		dest = to;
 		do {
-			dest = itineraryMatrix[numOfBoxes * from + dest];
+			dest = _v0ItineraryMatrix[numOfBoxes * from + dest];
 		} while (dest != Actor::kInvalidBox && !areBoxesNeighbors(from, dest));
 
 		if (dest == Actor::kInvalidBox)
 			dest = -1;
 
-		free(itineraryMatrix);
 		return dest;
 	} else if (_game.version <= 2) {
 		// The v2 box matrix is a real matrix with numOfBoxes rows and columns.
@@ -962,6 +982,9 @@ void ScummEngine::calcItineraryMatrix(byte *itineraryMatrix, int num) {
 	// Allocate the adjacent & itinerary matrices
 	adjacentMatrix = (byte *)malloc(boxSize * boxSize);
 
+	Common::Array<bool> neighbors;
+	calcBoxNeighbors(neighbors, num);
+
 	// Initialize the adjacent matrix: each box has distance 0 to itself,
 	// and distance 1 to its direct neighbors. Initially, it has distance
 	// 255 (= infinity) to all other boxes.
@@ -970,7 +993,7 @@ void ScummEngine::calcItineraryMatrix(byte *itineraryMatrix, int num) {
 			if (i == j) {
 				adjacentMatrix[i * boxSize + j] = 0;
 				itineraryMatrix[i * boxSize + j] = j;
-			} else if (areBoxesNeighbors(i, j)) {
+			} else if (neighbors[i * num + j]) {
 				adjacentMatrix[i * boxSize + j] = 1;
 				itineraryMatrix[i * boxSize + j] = j;
 			} else {
@@ -1005,12 +1028,73 @@ void ScummEngine::calcItineraryMatrix(byte *itineraryMatrix, int num) {
 	free(adjacentMatrix);
 }
 
+/**
+ * Determines which boxes are direct neighbors of each other. The result is
+ * stored as a num * num matrix.
+ */
+void ScummEngine::calcBoxNeighbors(Common::Array<bool> &neighbors, int num) {
+	neighbors.resize(num * num);
+
+	if (_game.version == 0) {
+		for (int i = 0; i < num; i++)
+			for (int j = 0; j < num; j++)
+				neighbors[i * num + j] = areBoxesNeighbors(i, j);
+		return;
+	}
+
+	// Whether two boxes touch only depends on their coordinates, while
+	// scripts mostly change box flags. So the expensive geometric part is
+	// kept until the coordinates change, and only the flags are applied here.
+	Common::Array<BoxCoords> coords;
+	Common::Array<int16> coordsKey;
+	for (int i = 0; i < num; i++) {
+		coords.push_back(getBoxCoordinates(i));
+		appendBoxCoords(coordsKey, coords[i]);
+	}
+
+	if (!(coordsKey == _boxesTouchingCoords)) {
+		_boxesTouchingCoords = coordsKey;
+		_boxesTouching.resize(num * num);
+		for (int i = 0; i < num; i++)
+			for (int j = 0; j < num; j++)
+				_boxesTouching[i * num + j] = (i != j) && boxesTouch(coords[i], coords[j]);
+	}
+
+	for (int i = 0; i < num; i++) {
+		const bool invisible = (getBoxFlags(i) & kBoxInvisible) != 0;
+		for (int j = 0; j < num; j++)
+			neighbors[i * num + j] = !invisible && !(getBoxFlags(j) & kBoxInvisible) && _boxesTouching[i * num + j];
+	}
+}
+
 void ScummEngine::createBoxMatrix() {
 	int num, i, j;
 
 	// The total number of boxes
 	num = getNumBoxes();
 
+	// Scripts often switch the same boxes on and off again, so the matrices
+	// of the last few box configurations are kept. Only the coordinates and
+	// the invisible flag of the boxes affect the matrix.
+	Common::Array<int16> key;
+	for (i = 0; i < num; i++) {
+		appendBoxCoords(key, getBoxCoordinates(i));
+		key.push_back(getBoxFlags(i) & kBoxInvisible);
+	}
+
+	for (Common::List<BoxMatrixCacheEntry>::iterator it = _boxMatrixCache.begin(); it != _boxMatrixCache.end(); ++it) {
+		if (it->key == key) {
+			byte *matrix = _res->createResource(rtMatrix, 1, BOX_MATRIX_SIZE);
+			memcpy(matrix, it->matrix.begin(), it->matrix.size());
+
+			// Move the entry to the front, it is now the most recently used one
+			BoxMatrixCacheEntry entry = *it;
+			_boxMatrixCache.erase(it);
+			_boxMatrixCache.push_front(entry);
+			return;
+		}
+	}
+
 	const uint8 boxSize = (_game.version == 0) ? num : 64;
 
 	// calculate shortest paths
@@ -1030,6 +1114,7 @@ void ScummEngine::createBoxMatrix() {
 	// See also getNextBox.
 
 	byte *matrixStart = _res->createResource(rtMatrix, 1, BOX_MATRIX_SIZE);
+	const byte *matrixBegin = matrixStart;
 	const byte *matrixEnd = matrixStart + BOX_MATRIX_SIZE;
 
 	#define addToMatrix(b)	do { *matrixStart++ = (b); assert(matrixStart < matrixEnd); } while (0)
@@ -1049,6 +1134,13 @@ void ScummEngine::createBoxMatrix() {
 	}
 	addToMatrix(0xFF);
 
+	BoxMatrixCacheEntry entry;
+	entry.key = key;
+	entry.matrix.resize(matrixStart - matrixBegin);
+	memcpy(entry.matrix.begin(), matrixBegin, entry.matrix.size());
+	_boxMatrixCache.push_front(entry);
+	if (_boxMatrixCache.size() > kBoxMatrixCacheSize)
+		_boxMatrixCache.pop_back();
 
 #if BOX_DEBUG
 	debug("Itinerary matrix:\n");
@@ -1062,16 +1154,16 @@ void ScummEngine::createBoxMatrix() {
 
 /** Check if two boxes are neighbors. */
 bool ScummEngine::areBoxesNeighbors(int box1nr, int box2nr) {
-	Common::Point tmp;
-	BoxCoords box;
-	BoxCoords box2;
-
 	if ((getBoxFlags(box1nr) & kBoxInvisible) || (getBoxFlags(box2nr) & kBoxInvisible))
 		return false;
 
 	assert(_game.version >= 3);
-	box2 = getBoxCoordinates(box1nr);
-	box = getBoxCoordinates(box2nr);
+	return boxesTouch(getBoxCoordinates(box1nr), getBoxCoordinates(box2nr));
+}
+
+/** Check if two boxes share a part of one of their sides. */
+static bool boxesTouch(BoxCoords box2, BoxCoords box) {
+	Common::Point tmp;
 
 	// Roughly, the idea of this algorithm is to search for sies of the given
 	// boxes that touch each other.
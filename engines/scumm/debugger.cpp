@@ -78,6 +78,7 @@ ScummDebugger::ScummDebugger(ScummEngine *s)
 	DCmd_Register("script",    WRAP_METHOD(ScummDebugger, Cmd_Script));
 	DCmd_Register("scr",       WRAP_METHOD(ScummDebugger, Cmd_Script));
 	DCmd_Register("scripts",   WRAP_METHOD(ScummDebugger, Cmd_PrintScript));
+	DCmd_Register("opcodes",   WRAP_METHOD(ScummDebugger, Cmd_OpcodeCounts));
 	DCmd_Register("importres", WRAP_METHOD(ScummDebugger, Cmd_ImportRes));
 
 	if (_vm->_game.id == GID_LOOM)
@@ -330,6 +331,52 @@ bool ScummDebugger::Cmd_PrintScript(int argc, const char **argv) {
 	return true;
 }
 
+bool ScummDebugger::Cmd_OpcodeCounts(int argc, const char **argv) {
+	if (argc == 2 && !strcmp(argv[1], "start")) {
+		if (!_vm->_opcodeCounts)
+			_vm->_opcodeCounts = new uint32[256];
+		memset(_vm->_opcodeCounts, 0, 256 * sizeof(uint32));
+		DebugPrintf("Counting executed opcodes\n");
+		return true;
+	} else if (argc == 2 && !strcmp(argv[1], "stop")) {
+		delete[] _vm->_opcodeCounts;
+		_vm->_opcodeCounts = NULL;
+		DebugPrintf("Stopped counting executed opcodes\n");
+		return true;
+	} else if (argc != 1) {
+		DebugPrintf("Syntax: opcodes [start|stop]\n");
+		return true;
+	}
+
+	if (!_vm->_opcodeCounts) {
+		DebugPrintf("Opcodes are not being counted, use 'opcodes start' first\n");
+		return true;
+	}
+
+	// Print the opcodes ordered by how often they have been executed
+	int order[256];
+	for (int i = 0; i < 256; i++)
+		order[i] = i;
+	for (int i = 1; i < 256; i++) {
+		const int op = order[i];
+		int j = i;
+		for (; j > 0 && _vm->_opcodeCounts[order[j - 1]] < _vm->_opcodeCounts[op]; j--)
+			order[j] = order[j - 1];
+		order[j] = op;
+	}
+
+	uint32 total = 0;
+	for (int i = 0; i < 256; i++)
+		total += _vm->_opcodeCounts[i];
+
+	DebugPrintf("%u opcodes executed\n", total);
+	for (int i = 0; i < 256 && _vm->_opcodeCounts[order[i]]; i++) {
+		DebugPrintf("%02x %10u %s\n", order[i], _vm->_opcodeCounts[order[i]], _vm->getOpcodeDesc(order[i]));
+	}
+
+	return true;
+}
+
 bool ScummDebugger::Cmd_Actor(int argc, const char **argv) {
 	Actor *a;
 	int actnum;
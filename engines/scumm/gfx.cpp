@@ -214,10 +214,16 @@ Gdi::Gdi(ScummEngine *vm) : _vm(vm) {
 	_vertStripNextInc = 0;
 	_zbufferDisabled = false;
 	_objectMode = false;
+	_lastStripOpaque = false;
 	_distaff = false;
+
+	_stripCacheImage = 0;
+	_stripCacheHeight = 0;
+	memset(_stripCachePalette, 0, sizeof(_stripCachePalette));
 }
 
 Gdi::~Gdi() {
+	clearStripCache();
 }
 
 GdiHE::GdiHE(ScummEngine *vm) : Gdi(vm), _tmskPtr(0) {
@@ -272,9 +278,12 @@ void Gdi::init() {
 		// the backbuf (thus we have to treat the right border seperately).
 		_numStrips += 1;
 	}
+
+	clearStripCache();
 }
 
 void Gdi::roomChanged(byte *roomptr) {
+	clearStripCache();
 }
 
 void GdiNES::roomChanged(byte *roomptr) {
@@ -1008,7 +1017,7 @@ void ScummEngine::redrawBGStrip(int start, int num) {
 	else
 		room = getResourceAddress(rtRoom, _roomResource);
 
-	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, 0);
+	_gdi->drawBitmap(room + _IM00_offs, &_virtscr[kMainVirtScreen], s, 0, _roomWidth, _virtscr[kMainVirtScreen].h, s, num, Gdi::dbRoomBackground);
 }
 
 void ScummEngine::restoreBackground(Common::Rect rect, byte backColor) {
@@ -1795,6 +1804,27 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 	_objectMode = (flag & dbObjectMode) == dbObjectMode;
 	prepareDrawBitmap(ptr, vs, x, y, width, height, stripnr, numstrip);
 
+	// The room background gets redrawn from the same data over and over
+	// again, e.g. while scrolling, so keep the strips once they are decoded.
+	// 16 bit HE games look their colors up at draw time, so they always
+	// decode the strips.
+	const bool useStripCache = (flag & dbRoomBackground) && vs->format.bytesPerPixel == 1;
+	uint16 zplanes = 0;
+	if (useStripCache) {
+		if (ptr != _stripCacheImage || height != _stripCacheHeight ||
+		    memcmp(_stripCachePalette, _vm->_roomPalette, sizeof(_stripCachePalette))) {
+			clearStripCache();
+			_stripCacheImage = ptr;
+			_stripCacheHeight = height;
+			memcpy(_stripCachePalette, _vm->_roomPalette, sizeof(_stripCachePalette));
+		}
+
+		for (int i = 1; i < numzbuf; i++) {
+			if (zplane_list[i])
+				zplanes |= 1 << i;
+		}
+	}
+
 	sx = x - vs->xstart / 8;
 	if (sx < 0) {
 		numstrip -= -sx;
@@ -1827,7 +1857,21 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 		else
 			dstPtr = (byte *)vs->getBasePtr(x * 8, y);
 
-		transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+		const CachedStrip *cached = 0;
+		if (useStripCache && stripnr < (int)_stripCache.size() && _stripCache[stripnr].data &&
+		    _stripCache[stripnr].zplanes == zplanes)
+			cached = &_stripCache[stripnr];
+
+		bool opaqueStrip;
+		if (cached) {
+			restoreStrip(x, y, height, *cached, dstPtr, vs->pitch);
+			transpStrip = false;
+			opaqueStrip = false;
+		} else {
+			_lastStripOpaque = false;
+			transpStrip = drawStrip(dstPtr, vs, x, y, width, height, stripnr, smap_ptr);
+			opaqueStrip = _lastStripOpaque;
+		}
 
 		// COMI and HE games only uses flag value
 		if (_vm->_game.version == 8 || _vm->_game.heversion >= 60)
@@ -1841,7 +1885,12 @@ void Gdi::drawBitmap(const byte *ptr, VirtScreen *vs, int x, const int y, const
 				clear8Col(frontBuf, vs->pitch, height, vs->format.bytesPerPixel);
 		}
 
-		decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+		if (!cached) {
+			decodeMask(x, y, width, height, stripnr, numzbuf, zplane_list, transpStrip, flag);
+
+			if (useStripCache && opaqueStrip)
+				cacheStrip(x, y, height, stripnr, zplanes, dstPtr, vs->pitch);
+		}
 
 #if 0
 		// HACK: blit mask(s) onto normal screen. Useful to debug masking
@@ -1911,6 +1960,59 @@ bool Gdi::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width,
 	return decompressBitmap(dstPtr, vs->pitch, smap_ptr + offset, height);
 }
 
+void Gdi::clearStripCache() {
+	for (uint i = 0; i < _stripCache.size(); i++)
+		free(_stripCache[i].data);
+	_stripCache.clear();
+	_stripCacheImage = 0;
+	_stripCacheHeight = 0;
+}
+
+void Gdi::cacheStrip(int x, int y, int height, int stripnr, uint16 zplanes, const byte *src, int srcPitch) {
+	int numPlanes = 0;
+	for (int i = 1; i < 9; i++) {
+		if (zplanes & (1 << i))
+			numPlanes++;
+	}
+
+	if (stripnr >= (int)_stripCache.size())
+		_stripCache.resize(stripnr + 1);
+
+	CachedStrip &strip = _stripCache[stripnr];
+	free(strip.data);
+	strip.data = (byte *)malloc(height * (8 + numPlanes));
+	strip.zplanes = zplanes;
+	if (!strip.data)
+		return;
+
+	// The pixels come first, followed by one byte per line for every z-plane
+	byte *dst = strip.data;
+	for (int h = 0; h < height; h++, src += srcPitch, dst += 8)
+		memcpy(dst, src, 8);
+
+	for (int i = 1; i < 9; i++) {
+		if (!(zplanes & (1 << i)))
+			continue;
+		const byte *mask_ptr = getMaskBuffer(x, y, i);
+		for (int h = 0; h < height; h++, mask_ptr += _numStrips)
+			*dst++ = *mask_ptr;
+	}
+}
+
+void Gdi::restoreStrip(int x, int y, int height, const CachedStrip &strip, byte *dst, int dstPitch) {
+	const byte *src = strip.data;
+	for (int h = 0; h < height; h++, src += 8, dst += dstPitch)
+		memcpy(dst, src, 8);
+
+	for (int i = 1; i < 9; i++) {
+		if (!(strip.zplanes & (1 << i)))
+			continue;
+		byte *mask_ptr = getMaskBuffer(x, y, i);
+		for (int h = 0; h < height; h++, mask_ptr += _numStrips)
+			*mask_ptr = *src++;
+	}
+}
+
 bool GdiNES::drawStrip(byte *dstPtr, VirtScreen *vs, int x, int y, const int width, const int height,
 					int stripnr, const byte *smap_ptr) {
 	byte *mask_ptr = getMaskBuffer(x, y, 1);
@@ -2283,6 +2385,7 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 
 	if (_vm->_game.features & GF_16COLOR) {
 		drawStripEGA(dst, dstPitch, src, numLinesToProcess);
+		_lastStripOpaque = true;
 		return false;
 	}
 
@@ -2419,6 +2522,9 @@ bool Gdi::decompressBitmap(byte *dst, int dstPitch, const byte *src, int numLine
 		error("Gdi::decompressBitmap: default case %d", code);
 	}
 
+	// Code 149 skips transparent pixels, even though it is not flagged as such
+	_lastStripOpaque = !transpStrip && code != 149;
+
 	return transpStrip;
 }
 
@@ -23,6 +23,7 @@
 #ifndef SCUMM_GFX_H
 #define SCUMM_GFX_H
 
+#include "common/array.h"
 #include "common/system.h"
 #include "common/list.h"
 
@@ -197,6 +198,27 @@ protected:
 	/** Flag which is true when an object is being rendered, false otherwise. */
 	bool _objectMode;
 
+	/** Flag which is true if the last strip decompressBitmap() drew had no transparent pixels. */
+	bool _lastStripOpaque;
+
+	/**
+	 * Decoded strips of the room background, together with their z-plane
+	 * masks. A strip is stored the first time it is drawn, the whole cache is
+	 * dropped when the room, its image or the room palette change.
+	 */
+	struct CachedStrip {
+		byte *data;
+		uint16 zplanes;
+	};
+	Common::Array<CachedStrip> _stripCache;
+	const byte *_stripCacheImage;
+	int _stripCacheHeight;
+	byte _stripCachePalette[256];
+
+	void clearStripCache();
+	void cacheStrip(int x, int y, int height, int stripnr, uint16 zplanes, const byte *src, int srcPitch);
+	void restoreStrip(int x, int y, int height, const CachedStrip &strip, byte *dst, int dstPitch);
+
 public:
 	/** Flag which is true when loading objects or titles for distaff, in PCEngine version of Loom. */
 	bool _distaff;
@@ -268,9 +290,10 @@ public:
 	void resetBackground(int top, int bottom, int strip);
 
 	enum DrawBitmapFlags {
-		dbAllowMaskOr   = 1 << 0,
-		dbDrawMaskOnAll = 1 << 1,
-		dbObjectMode    = 2 << 2
+		dbAllowMaskOr    = 1 << 0,
+		dbDrawMaskOnAll  = 1 << 1,
+		dbObjectMode     = 2 << 2,
+		dbRoomBackground = 1 << 4
 	};
 };
 
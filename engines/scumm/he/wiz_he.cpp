@@ -40,6 +40,8 @@ Wiz::Wiz(ScummEngine_v71he *vm) : _vm(vm) {
 	memset(&_polygons, 0, sizeof(_polygons));
 	_cursorImage = false;
 	_rectOverrideEnabled = false;
+	_decodedImagesSize = 0;
+	_decodedImagesCounter = 0;
 }
 
 void Wiz::clearWizBuffer() {
@@ -1049,7 +1051,7 @@ uint16 Wiz::getWizPixelColor(const uint8 *data, int x, int y, int w, int h, uint
 		} else {
 			code = (code >> 2) + 1;
 			if (code > x) {
-				return (bitDepth == 2) ? READ_LE_UINT16(data + x) : data[x];
+				return (bitDepth == 2) ? READ_LE_UINT16(data + x * 2) : data[x];
 			}
 			x -= code;
 			data += code * bitDepth;
@@ -1057,12 +1059,83 @@ uint16 Wiz::getWizPixelColor(const uint8 *data, int x, int y, int w, int h, uint
 	}
 
 	if (bitDepth == 2)
-		return (READ_LE_UINT16(data) & 1) ? color : READ_LE_UINT16(data + 2);
+		return (data[0] & 1) ? color : READ_LE_UINT16(data + 1);
 	else
 		return (data[0] & 1) ? color : data[1];
 
 }
 
+const Wiz::DecodedWizImage *Wiz::getDecodedWizImage(int resNum, int state, const uint8 *data, int w, int h, uint8 bitDepth) {
+	// Images changed by scripts are always marked as modified; only the
+	// images loaded from the game files are decoded, as they never change.
+	if (_vm->_res->isModified(rtImage, resNum))
+		return NULL;
+
+	for (Common::List<DecodedWizImage>::iterator i = _decodedImages.begin(); i != _decodedImages.end(); ++i) {
+		if (i->resNum == resNum && i->state == state && i->data == data) {
+			i->lastUsed = ++_decodedImagesCounter;
+			return &*i;
+		}
+	}
+
+	if ((uint32)(w * h) * 3 > kDecodedImageCacheSize)
+		return NULL;
+
+	_decodedImages.push_front(DecodedWizImage());
+	DecodedWizImage &img = _decodedImages.front();
+	img.resNum = resNum;
+	img.state = state;
+	img.data = data;
+	img.lastUsed = ++_decodedImagesCounter;
+	img.w = w;
+	img.h = h;
+	img.pixels.resize(w * h);
+	img.opaque.resize((w * h + 7) / 8);
+	memset(img.opaque.begin(), 0, img.opaque.size());
+
+	const uint8 *src = data;
+	for (int y = 0; y < h; y++) {
+		const uint16 off = READ_LE_UINT16(src); src += 2;
+		const uint8 *rowEnd = src + off;
+		int x = 0;
+		while (x < w && src < rowEnd) {
+			uint8 code = *src++;
+			if (code & 1) {
+				x += code >> 1;
+			} else if (code & 2) {
+				const uint16 color = (bitDepth == 2) ? READ_LE_UINT16(src) : src[0];
+				src += bitDepth;
+				for (int n = (code >> 2) + 1; n > 0 && x < w; --n, ++x) {
+					img.pixels[y * w + x] = color;
+					img.opaque[(y * w + x) >> 3] |= 1 << ((y * w + x) & 7);
+				}
+			} else {
+				for (int n = (code >> 2) + 1; n > 0; --n, src += bitDepth, ++x) {
+					if (x >= w)
+						continue;
+					img.pixels[y * w + x] = (bitDepth == 2) ? READ_LE_UINT16(src) : src[0];
+					img.opaque[(y * w + x) >> 3] |= 1 << ((y * w + x) & 7);
+				}
+			}
+		}
+		src = rowEnd;
+	}
+
+	// Drop the least recently used images until the new one fits
+	_decodedImagesSize += img.getSize();
+	while (_decodedImagesSize > kDecodedImageCacheSize) {
+		Common::List<DecodedWizImage>::iterator oldest = _decodedImages.begin();
+		for (Common::List<DecodedWizImage>::iterator i = _decodedImages.begin(); i != _decodedImages.end(); ++i) {
+			if (i->lastUsed < oldest->lastUsed)
+				oldest = i;
+		}
+		_decodedImagesSize -= oldest->getSize();
+		_decodedImages.erase(oldest);
+	}
+
+	return &_decodedImages.front();
+}
+
 uint16 Wiz::getRawWizPixelColor(const uint8 *data, int x, int y, int w, int h, uint8 bitDepth, uint16 color) {
 	if (x < 0 || x >= w || y < 0 || y >= h) {
 		return color;
@@ -2591,8 +2664,18 @@ int Wiz::isWizPixelNonTransparent(int resNum, int state, int x, int y, int flags
 			}
 			break;
 		case 1:
-			ret = isWizPixelNonTransparent(wizd, x, y, w, h, 1);
+#ifdef USE_RGB_COLOR
+		case 5:
+#endif
+		{
+			const uint8 bitDepth = (c == 5) ? 2 : 1;
+			const DecodedWizImage *img = getDecodedWizImage(resNum, state, wizd, w, h, bitDepth);
+			if (img)
+				ret = img->isOpaque(x, y) ? 1 : 0;
+			else
+				ret = isWizPixelNonTransparent(wizd, x, y, w, h, bitDepth);
 			break;
+		}
 #ifdef USE_RGB_COLOR
 		case 2:
 			ret = getRawWizPixelColor(wizd, x, y, w, h, 2, _vm->VAR(_vm->VAR_WIZ_TCOLOR)) != _vm->VAR(_vm->VAR_WIZ_TCOLOR) ? 1 : 0;
@@ -2602,9 +2685,6 @@ int Wiz::isWizPixelNonTransparent(int resNum, int state, int x, int y, int flags
 			ret = 1;
 			debug(0, "isWizPixelNonTransparent: Unhandled wiz compression type %d", c);
 			break;
-		case 5:
-			ret = isWizPixelNonTransparent(wizd, x, y, w, h, 2);
-			break;
 #endif
 		default:
 			error("isWizPixelNonTransparent: Unhandled wiz compression type %d", c);
@@ -2634,8 +2714,20 @@ uint16 Wiz::getWizPixelColor(int resNum, int state, int x, int y) {
 		}
 		break;
 	case 1:
-		color = getWizPixelColor(wizd, x, y, w, h, 1, _vm->VAR(_vm->VAR_WIZ_TCOLOR));
+#ifdef USE_RGB_COLOR
+	case 5:
+#endif
+	{
+		const uint8 bitDepth = (c == 5) ? 2 : 1;
+		const DecodedWizImage *img = getDecodedWizImage(resNum, state, wizd, w, h, bitDepth);
+		if (!img)
+			color = getWizPixelColor(wizd, x, y, w, h, bitDepth, _vm->VAR(_vm->VAR_WIZ_TCOLOR));
+		else if (x >= 0 && x < w && y >= 0 && y < h && img->isOpaque(x, y))
+			color = img->pixels[y * w + x];
+		else
+			color = _vm->VAR(_vm->VAR_WIZ_TCOLOR);
 		break;
+	}
 #ifdef USE_RGB_COLOR
 	case 2:
 		color = getRawWizPixelColor(wizd, x, y, w, h, 2, _vm->VAR(_vm->VAR_WIZ_TCOLOR));
@@ -2644,9 +2736,6 @@ uint16 Wiz::getWizPixelColor(int resNum, int state, int x, int y) {
 		// TODO: Unknown image type
 		debug(0, "getWizPixelColor: Unhandled wiz compression type %d", c);
 		break;
-	case 5:
-		color = getWizPixelColor(wizd, x, y, w, h, 2, _vm->VAR(_vm->VAR_WIZ_TCOLOR));
-		break;
 #endif
 	default:
 		error("getWizPixelColor: Unhandled wiz compression type %d", c);
@@ -23,6 +23,8 @@
 #if !defined(SCUMM_HE_WIZ_HE_H) && defined(ENABLE_HE)
 #define SCUMM_HE_WIZ_HE_H
 
+#include "common/array.h"
+#include "common/list.h"
 #include "common/rect.h"
 
 namespace Scumm {
@@ -238,6 +240,37 @@ public:
 
 private:
 	ScummEngine_v71he *_vm;
+
+	/**
+	 * A compressed image decoded for hit testing, so looking up a pixel does
+	 * not need to walk the RLE data up to it.
+	 */
+	struct DecodedWizImage {
+		int resNum;
+		int state;
+		const uint8 *data;
+		uint32 lastUsed;
+		int w, h;
+		Common::Array<uint16> pixels;
+		Common::Array<uint8> opaque; // one bit per pixel
+
+		bool isOpaque(int x, int y) const {
+			const int i = y * w + x;
+			return (opaque[i >> 3] & (1 << (i & 7))) != 0;
+		}
+		uint32 getSize() const { return pixels.size() * sizeof(uint16) + opaque.size(); }
+	};
+
+	enum {
+		kDecodedImageCacheSize = 4 * 1024 * 1024
+	};
+
+	/** Recently hit tested images */
+	Common::List<DecodedWizImage> _decodedImages;
+	uint32 _decodedImagesSize;
+	uint32 _decodedImagesCounter;
+
+	const DecodedWizImage *getDecodedWizImage(int resNum, int state, const uint8 *data, int w, int h, uint8 bitDepth);
 };
 
 } // End of namespace Scumm
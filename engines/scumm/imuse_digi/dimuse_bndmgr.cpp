@@ -139,14 +139,68 @@ int BundleDirCache::matchFile(const char *filename) {
 	}
 }
 
-BundleMgr::BundleMgr(BundleDirCache *cache) {
+BundleBlockCache::BundleBlockCache() : _useCounter(0) {
+	for (int i = 0; i < kNumBlocks; i++) {
+		_blocks[i].slot = -1;
+		_blocks[i].index = -1;
+		_blocks[i].block = -1;
+		_blocks[i].outputSize = 0;
+		_blocks[i].lastUsed = 0;
+		_blocks[i].data = NULL;
+	}
+}
+
+BundleBlockCache::~BundleBlockCache() {
+	for (int i = 0; i < kNumBlocks; i++)
+		free(_blocks[i].data);
+}
+
+const byte *BundleBlockCache::find(int slot, int32 index, int32 block, int32 &outputSize) {
+	for (int i = 0; i < kNumBlocks; i++) {
+		Block &b = _blocks[i];
+		if (b.block == block && b.index == index && b.slot == slot) {
+			b.lastUsed = ++_useCounter;
+			outputSize = b.outputSize;
+			return b.data;
+		}
+	}
+
+	return NULL;
+}
+
+void BundleBlockCache::insert(int slot, int32 index, int32 block, const byte *data, int32 outputSize) {
+	assert(outputSize <= kBlockSize);
+
+	// Reuse the least recently used block; unused ones have never been used
+	Block *victim = &_blocks[0];
+	for (int i = 1; i < kNumBlocks; i++) {
+		if (_blocks[i].lastUsed < victim->lastUsed)
+			victim = &_blocks[i];
+	}
+
+	if (!victim->data) {
+		victim->data = (byte *)malloc(kBlockSize);
+		assert(victim->data);
+	}
+
+	victim->slot = slot;
+	victim->index = index;
+	victim->block = block;
+	victim->outputSize = outputSize;
+	victim->lastUsed = ++_useCounter;
+	memcpy(victim->data, data, outputSize);
+}
+
+BundleMgr::BundleMgr(BundleDirCache *cache, BundleBlockCache *blockCache) {
 	_cache = cache;
+	_blockCache = blockCache;
 	_bundleTable = NULL;
 	_compTable = NULL;
 	_numFiles = 0;
 	_numCompItems = 0;
 	_curSampleId = -1;
 	_fileBundleId = -1;
+	_slot = -1;
 	_file = new ScummFile();
 	_compInputBuff = NULL;
 }
@@ -184,13 +238,13 @@ bool BundleMgr::open(const char *filename, bool &compressed, bool errorFlag) {
 		return false;
 	}
 
-	int slot = _cache->matchFile(filename);
-	assert(slot != -1);
-	compressed = _cache->isSndDataExtComp(slot);
-	_numFiles = _cache->getNumFiles(slot);
+	_slot = _cache->matchFile(filename);
+	assert(_slot != -1);
+	compressed = _cache->isSndDataExtComp(_slot);
+	_numFiles = _cache->getNumFiles(_slot);
 	assert(_numFiles);
-	_bundleTable = _cache->getTable(slot);
-	_indexTable = _cache->getIndexTable(slot);
+	_bundleTable = _cache->getTable(_slot);
+	_indexTable = _cache->getIndexTable(_slot);
 	assert(_bundleTable);
 	_compTableLoaded = false;
 	_outputSize = 0;
@@ -288,13 +342,20 @@ int32 BundleMgr::decompressSampleByIndex(int32 index, int32 offset, int32 size,
 
 	for (i = firstBlock; i <= lastBlock; i++) {
 		if (_lastBlock != i) {
-			// CMI hack: one more zero byte at the end of input buffer
-			_compInputBuff[_compTable[i].size] = 0;
-			_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
-			_file->read(_compInputBuff, _compTable[i].size);
-			_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
-			if (_outputSize > 0x2000) {
-				error("_outputSize: %d", _outputSize);
+			// Another track may have decompressed this block recently
+			const byte *cached = _blockCache->find(_slot, index, i, _outputSize);
+			if (cached) {
+				memcpy(_compOutputBuff, cached, _outputSize);
+			} else {
+				// CMI hack: one more zero byte at the end of input buffer
+				_compInputBuff[_compTable[i].size] = 0;
+				_file->seek(_bundleTable[index].offset + _compTable[i].offset, SEEK_SET);
+				_file->read(_compInputBuff, _compTable[i].size);
+				_outputSize = BundleCodecs::decompressCodec(_compTable[i].codec, _compInputBuff, _compOutputBuff, _compTable[i].size);
+				if (_outputSize > 0x2000) {
+					error("_outputSize: %d", _outputSize);
+				}
+				_blockCache->insert(_slot, index, i, _compOutputBuff, _outputSize);
 			}
 			_lastBlock = i;
 		}
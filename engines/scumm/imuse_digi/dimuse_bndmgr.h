@@ -64,6 +64,41 @@ public:
 	bool isSndDataExtComp(int slot);
 };
 
+/**
+ * Decompressed blocks of bundled sounds, shared by all BundleMgr instances.
+ * Crossfades and region jumps make several tracks read the same blocks, which
+ * then only need to be decompressed once. The least recently used blocks are
+ * dropped first. Access is serialized by the IMuseDigital mutex.
+ */
+class BundleBlockCache {
+public:
+	BundleBlockCache();
+	~BundleBlockCache();
+
+	/** Return the cached block, or NULL if it is not in the cache. */
+	const byte *find(int slot, int32 index, int32 block, int32 &outputSize);
+
+	/** Store a copy of a decompressed block. */
+	void insert(int slot, int32 index, int32 block, const byte *data, int32 outputSize);
+
+private:
+	enum {
+		kNumBlocks = 128,
+		kBlockSize = 0x2000
+	};
+
+	struct Block {
+		int slot;
+		int32 index;
+		int32 block;
+		int32 outputSize;
+		uint32 lastUsed;
+		byte *data;
+	} _blocks[kNumBlocks];
+
+	uint32 _useCounter;
+};
+
 class BundleMgr {
 
 private:
@@ -75,6 +110,7 @@ private:
 	};
 
 	BundleDirCache *_cache;
+	BundleBlockCache *_blockCache;
 	BundleDirCache::AudioTable *_bundleTable;
 	BundleDirCache::IndexNode *_indexTable;
 	CompTable *_compTable;
@@ -85,6 +121,7 @@ private:
 	BaseScummFile *_file;
 	bool _compTableLoaded;
 	int _fileBundleId;
+	int _slot;
 	byte _compOutputBuff[0x2000];
 	byte *_compInputBuff;
 	int _outputSize;
@@ -94,7 +131,7 @@ private:
 
 public:
 
-	BundleMgr(BundleDirCache *_cache);
+	BundleMgr(BundleDirCache *cache, BundleBlockCache *blockCache);
 	~BundleMgr();
 
 	bool open(const char *filename, bool &compressed, bool errorFlag = false);
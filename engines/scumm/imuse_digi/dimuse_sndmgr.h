@@ -32,6 +32,7 @@ namespace Scumm {
 
 class ScummEngine;
 class BundleMgr;
+class BundleBlockCache;
 
 class ImuseDigiSndMgr {
 public:
@@ -116,6 +117,7 @@ private:
 	ScummEngine *_vm;
 	byte _disk;
 	BundleDirCache *_cacheBundleDir;
+	BundleBlockCache *_cacheBundleBlocks;
 
 	bool openMusicBundle(SoundDesc *sound, int &disk);
 	bool openVoiceBundle(SoundDesc *sound, int &disk);
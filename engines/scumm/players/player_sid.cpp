@@ -22,6 +22,7 @@
 
 #ifndef DISABLE_SID
 
+#include "common/config-manager.h"
 #include "engines/engine.h"
 #include "scumm/players/player_sid.h"
 #include "scumm/scumm.h"
@@ -1309,6 +1310,7 @@ void Player_SID::initSID() {
 	_sid = new Resid::SID();
 	_sid->set_sampling_parameters(
 		timingProps[_videoSystem].clockFreq,
+		ConfMan.getBool("c64_interpolation") ? Resid::SAMPLE_INTERPOLATE : Resid::SAMPLE_FAST,
 		_sampleRate);
 	_sid->enable_filter(true);
 
@@ -24,6 +24,7 @@
 #include "scumm/players/player_v4a.h"
 #include "scumm/scumm.h"
 
+#include "common/config-manager.h"
 #include "common/file.h"
 
 namespace Scumm {
@@ -44,6 +45,10 @@ Player_V4A::Player_V4A(ScummEngine *scumm, Audio::Mixer *mixer)
 	assert(mixer);
 	assert(_vm->_game.id == GID_MONKEY_VGA);
 	_tfmxMusic.setSignalPtr(&_signal, 1);
+
+	const bool interpolate = ConfMan.getBool("amiga_interpolation");
+	_tfmxMusic.setInterpolation(interpolate);
+	_tfmxSfx.setInterpolation(interpolate);
 }
 
 bool Player_V4A::init() {
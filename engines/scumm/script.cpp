@@ -483,14 +483,17 @@ void ScummEngine::executeScript() {
 			debugN("\n");
 		}
 
+		if (_opcodeCounts)
+			_opcodeCounts[_opcode]++;
+
 		executeOpcode(_opcode);
 
 	}
 }
 
 void ScummEngine::executeOpcode(byte i) {
-	if (_opcodes[i].proc && _opcodes[i].proc->isValid())
-		(*_opcodes[i].proc)();
+	if (_opcodes[i].proc)
+		(this->*_opcodes[i].proc)();
 	else {
 		error("Invalid opcode '%x' at %lx", i, (long)(_scriptPointer - _scriptOrgPointer));
 	}
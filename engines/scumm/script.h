@@ -23,45 +23,14 @@
 #ifndef SCUMM_SCRIPT_H
 #define SCUMM_SCRIPT_H
 
-#include "common/func.h"
-
 namespace Scumm {
 
-typedef Common::Functor0<void> Opcode;
-
-struct OpcodeEntry : Common::NonCopyable {
-	Opcode *proc;
-#ifndef REDUCE_MEMORY_USAGE
-	const char *desc;
-#endif
-
-#ifndef REDUCE_MEMORY_USAGE
-	OpcodeEntry() : proc(0), desc(0) {}
-#else
-	OpcodeEntry() : proc(0) {}
-#endif
-	~OpcodeEntry() {
-		setProc(0, 0);
-	}
-
-	void setProc(Opcode *p, const char *d) {
-		if (proc != p) {
-			delete proc;
-			proc = p;
-		}
-#ifndef REDUCE_MEMORY_USAGE
-		desc = d;
-#endif
-	}
-};
-
-
 // This is to help devices with small memory (PDA, smartphones, ...)
 // to save abit of memory used by opcode names in the Scumm engine.
 #ifndef REDUCE_MEMORY_USAGE
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), #x)
+#	define _OPCODE(ver, x)	setProc(static_cast<OpcodeProc>(&ver::x), #x)
 #else
-#	define _OPCODE(ver, x)	setProc(new Common::Functor0Mem<void, ver>(this, &ver::x), "")
+#	define _OPCODE(ver, x)	setProc(static_cast<OpcodeProc>(&ver::x), "")
 #endif
 
 /**
@@ -532,6 +532,7 @@ ScummEngine::ScummEngine(OSystem *syst, const DetectorResult &dr)
 
 	_hexdumpScripts = false;
 	_showStack = false;
+	_opcodeCounts = NULL;
 
 	if (_game.platform == Common::kPlatformFMTowns && _game.version == 3) {	// FM-TOWNS V3 games use 320x240
 		_screenWidth = 320;
@@ -598,6 +599,7 @@ ScummEngine::~ScummEngine() {
 	delete[] _sortedActors;
 
 	delete[] _2byteFontPtr;
+	delete[] _opcodeCounts;
 	delete _charset;
 	delete _messageDialog;
 	delete _pauseDialog;
@@ -25,11 +25,13 @@
 
 #include "engines/engine.h"
 
+#include "common/array.h"
 #include "common/endian.h"
 #include "common/events.h"
 #include "common/file.h"
 #include "common/savefile.h"
 #include "common/keyboard.h"
+#include "common/list.h"
 #include "common/random.h"
 #include "common/rect.h"
 #include "common/rendermode.h"
@@ -643,12 +645,42 @@ protected:
 	int _scummStackPos;
 	int _vmStack[150];
 
+	/**
+	 * Opcodes are plain member function pointers, so dispatching one is a
+	 * single indirect call. The OPCODE macros cast the handlers of the
+	 * subclasses to this type.
+	 */
+	typedef void (ScummEngine::*OpcodeProc)();
+
+	struct OpcodeEntry {
+		OpcodeProc proc;
+#ifndef REDUCE_MEMORY_USAGE
+		const char *desc;
+#endif
+
+#ifndef REDUCE_MEMORY_USAGE
+		OpcodeEntry() : proc(0), desc(0) {}
+#else
+		OpcodeEntry() : proc(0) {}
+#endif
+
+		void setProc(OpcodeProc p, const char *d) {
+			proc = p;
+#ifndef REDUCE_MEMORY_USAGE
+			desc = d;
+#endif
+		}
+	};
+
 	OpcodeEntry _opcodes[256];
 
 	virtual void setupOpcodes() = 0;
 	void executeOpcode(byte i);
 	const char *getOpcodeDesc(byte i);
 
+	/** Execution count of each opcode, only collected while non-NULL. */
+	uint32 *_opcodeCounts;
+
 	void initializeLocals(int slot, int *vars);
 	int	getScriptSlot();
 
@@ -1157,9 +1189,30 @@ protected:
 	void convertScaleTableToScaleSlot(int slot);
 
 	void calcItineraryMatrix(byte *itineraryMatrix, int num);
+	void calcBoxNeighbors(Common::Array<bool> &neighbors, int num);
 	void createBoxMatrix();
 	virtual bool areBoxesNeighbors(int i, int j);
 
+	enum {
+		kBoxMatrixCacheSize = 8
+	};
+
+	struct BoxMatrixCacheEntry {
+		Common::Array<int16> key;
+		Common::Array<byte> matrix;
+	};
+
+	/** Recently created box matrices, the most recently used one first. */
+	Common::List<BoxMatrixCacheEntry> _boxMatrixCache;
+
+	/** Which boxes touch each other, and the box coordinates this is valid for. */
+	Common::Array<bool> _boxesTouching;
+	Common::Array<int16> _boxesTouchingCoords;
+
+	/** v0 shortest paths, and the box matrix they were calculated from. */
+	Common::Array<byte> _v0ItineraryMatrix;
+	Common::Array<byte> _v0ItinerarySource;
+
 	/* String class */
 public:
 	CharsetRenderer *_charset;
@@ -24,6 +24,7 @@
 
 #include "common/config-manager.h"
 #include "common/file.h"
+#include "common/memstream.h"
 #include "common/system.h"
 #include "common/util.h"
 
@@ -222,6 +223,9 @@ SmushPlayer::SmushPlayer(ScummEngine_v7 *scumm) {
 	_base = NULL;
 	_frameBuffer = NULL;
 	_specialBuffer = NULL;
+	_prefetchBuffer = NULL;
+	_prefetchOffset = -1;
+	_prefetchSize = 0;
 
 	_seekPos = -1;
 
@@ -287,6 +291,8 @@ void SmushPlayer::release() {
 	delete _strings;
 	_strings = NULL;
 
+	discardPrefetchedFrame();
+
 	delete _base;
 	_base = NULL;
 
@@ -774,22 +780,41 @@ void SmushPlayer::decodeFrameObject(int codec, const uint8 *src, int left, int t
 }
 
 #ifdef USE_ZLIB
+byte *SmushPlayer::inflateFrameObject(const byte *chunk, int32 chunkSize) {
+	assert(chunkSize >= 4);
+	unsigned long decompressedSize = READ_BE_UINT32(chunk);
+	byte *fobjBuffer = (byte *)malloc(decompressedSize);
+	assert(fobjBuffer);
+	if (!Common::uncompress(fobjBuffer, &decompressedSize, chunk + 4, chunkSize - 4))
+		error("SmushPlayer::inflateFrameObject() Zlib uncompress error");
+	return fobjBuffer;
+}
+
 void SmushPlayer::handleZlibFrameObject(int32 subSize, Common::SeekableReadStream &b) {
 	if (_skipNext) {
 		_skipNext = false;
 		return;
 	}
 
-	int32 chunkSize = subSize;
-	byte *chunkBuffer = (byte *)malloc(chunkSize);
-	assert(chunkBuffer);
-	b.read(chunkBuffer, chunkSize);
+	// The object may have been inflated already when the frame was read ahead
+	byte *fobjBuffer = NULL;
+	for (uint i = 0; i < _inflatedObjects.size(); ++i) {
+		if (_inflatedObjects[i].offset == b.pos()) {
+			fobjBuffer = _inflatedObjects[i].data;
+			_inflatedObjects.remove_at(i);
+			break;
+		}
+	}
 
-	unsigned long decompressedSize = READ_BE_UINT32(chunkBuffer);
-	byte *fobjBuffer = (byte *)malloc(decompressedSize);
-	if (!Common::uncompress(fobjBuffer, &decompressedSize, chunkBuffer + 4, chunkSize - 4))
-		error("SmushPlayer::handleZlibFrameObject() Zlib uncompress error");
-	free(chunkBuffer);
+	if (!fobjBuffer) {
+		int32 chunkSize = subSize;
+		byte *chunkBuffer = (byte *)malloc(chunkSize);
+		assert(chunkBuffer);
+		b.read(chunkBuffer, chunkSize);
+
+		fobjBuffer = inflateFrameObject(chunkBuffer, chunkSize);
+		free(chunkBuffer);
+	}
 
 	byte *ptr = fobjBuffer;
 	int codec = READ_LE_UINT16(ptr); ptr += 2;
@@ -966,9 +991,73 @@ SmushFont *SmushPlayer::getFont(int font) {
 	return _sf[font];
 }
 
+void SmushPlayer::prefetchNextFrame() {
+	if (_prefetchBuffer || _seekPos >= 0 || _endOfFile || !_base)
+		return;
+
+	const int32 offset = _base->pos();
+	if (offset + 8 >= (int32)_baseSize)
+		return;
+
+	// Only frames are read ahead, anything else is left to parseNextFrame
+	const uint32 subType = _base->readUint32BE();
+	const int32 subSize = _base->readUint32BE();
+	if (subType == MKTAG('F','R','M','E') && subSize > 0) {
+		_prefetchBuffer = (byte *)malloc(subSize);
+		assert(_prefetchBuffer);
+		if (_base->read(_prefetchBuffer, subSize) == (uint32)subSize) {
+			_prefetchOffset = offset;
+			_prefetchSize = subSize;
+		} else {
+			free(_prefetchBuffer);
+			_prefetchBuffer = NULL;
+		}
+	}
+	_base->seek(offset, SEEK_SET);
+
+	if (!_prefetchBuffer)
+		return;
+
+#ifdef USE_ZLIB
+	// Inflating the compressed frame objects is the most expensive part of
+	// reading a frame, so get that out of the way now as well. The offsets
+	// match the positions handleZlibFrameObject sees in the frame stream.
+	int32 pos = 0;
+	while (pos + 8 <= _prefetchSize) {
+		const uint32 type = READ_BE_UINT32(_prefetchBuffer + pos);
+		const int32 size = READ_BE_UINT32(_prefetchBuffer + pos + 4);
+		pos += 8;
+		if (size < 0 || pos + size > _prefetchSize)
+			break;
+
+		if (type == MKTAG('Z','F','O','B') && size >= 4) {
+			InflatedObject object;
+			object.offset = pos;
+			object.data = inflateFrameObject(_prefetchBuffer + pos, size);
+			_inflatedObjects.push_back(object);
+		}
+
+		pos += size + (size & 1);
+	}
+#endif
+}
+
+void SmushPlayer::discardPrefetchedFrame() {
+	for (uint i = 0; i < _inflatedObjects.size(); ++i)
+		free(_inflatedObjects[i].data);
+	_inflatedObjects.clear();
+
+	free(_prefetchBuffer);
+	_prefetchBuffer = NULL;
+	_prefetchOffset = -1;
+	_prefetchSize = 0;
+}
+
 void SmushPlayer::parseNextFrame() {
 
 	if (_seekPos >= 0) {
+		discardPrefetchedFrame();
+
 		if (_smixer)
 			_smixer->stop();
 
@@ -1014,30 +1103,45 @@ void SmushPlayer::parseNextFrame() {
 
 	assert(_base);
 
-	const uint32 subType = _base->readUint32BE();
-	const int32 subSize = _base->readUint32BE();
-	const int32 subOffset = _base->pos();
+	if (_prefetchBuffer && _prefetchOffset == _base->pos()) {
+		const int32 subSize = _prefetchSize;
+		const int32 subOffset = _prefetchOffset + 8;
 
-	if (_base->pos() >= (int32)_baseSize) {
-		_vm->_smushVideoShouldFinish = true;
-		_endOfFile = true;
-		return;
-	}
+		debug(3, "Chunk: FRME at %x (read ahead)", subOffset);
 
-	debug(3, "Chunk: %s at %x", tag2str(subType), subOffset);
+		Common::MemoryReadStream frame(_prefetchBuffer, subSize);
+		handleFrame(subSize, frame);
+		discardPrefetchedFrame();
 
-	switch (subType) {
-	case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
-		handleAnimHeader(subSize, *_base);
-		break;
-	case MKTAG('F','R','M','E'):
-		handleFrame(subSize, *_base);
-		break;
-	default:
-		error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
-	}
+		_base->seek(subOffset + subSize, SEEK_SET);
+	} else {
+		discardPrefetchedFrame();
+
+		const uint32 subType = _base->readUint32BE();
+		const int32 subSize = _base->readUint32BE();
+		const int32 subOffset = _base->pos();
+
+		if (_base->pos() >= (int32)_baseSize) {
+			_vm->_smushVideoShouldFinish = true;
+			_endOfFile = true;
+			return;
+		}
+
+		debug(3, "Chunk: %s at %x", tag2str(subType), subOffset);
+
+		switch (subType) {
+		case MKTAG('A','H','D','R'): // FT INSANE may seek file to the beginning
+			handleAnimHeader(subSize, *_base);
+			break;
+		case MKTAG('F','R','M','E'):
+			handleFrame(subSize, *_base);
+			break;
+		default:
+			error("Unknown Chunk found at %x: %s, %d", subOffset, tag2str(subType), subSize);
+		}
 
-	_base->seek(subOffset + subSize, SEEK_SET);
+		_base->seek(subOffset + subSize, SEEK_SET);
+	}
 
 	if (_insanity)
 		_vm->_sound->processSound();
@@ -1178,6 +1282,7 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 	for (;;) {
 		uint32 now, elapsed;
 		bool skipFrame = false;
+		bool behind = false;
 
 		if (_insanity) {
 			// Seeking makes a mess of trying to sync the audio to
@@ -1203,6 +1308,7 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 				skipFrame = true;
 			else
 				skipFrame = false;
+			behind = skipFrame;
 			timerCallback();
 		}
 
@@ -1249,7 +1355,13 @@ void SmushPlayer::play(const char *filename, int32 speed, int32 offset, int32 st
 			_IACTpos = 0;
 			break;
 		}
-		_vm->_system->delayMillis(10);
+		if (!behind) {
+			// Use the time until the next frame is due to read it ahead,
+			// so only decoding and presenting it is left when it is due.
+			// When behind schedule, go straight on to the next frame.
+			prefetchNextFrame();
+			_vm->_system->delayMillis(10);
+		}
 	}
 
 	release();
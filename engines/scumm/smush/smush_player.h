@@ -23,6 +23,7 @@
 #if !defined(SCUMM_SMUSH_PLAYER_H) && defined(ENABLE_SCUMM_7_8)
 #define SCUMM_SMUSH_PLAYER_H
 
+#include "common/array.h"
 #include "common/util.h"
 #include "scumm/sound.h"
 
@@ -82,6 +83,17 @@ private:
 	bool _middleAudio;
 	bool _skipPalette;
 
+	// The next frame, read ahead while waiting for the current one to be shown
+	byte *_prefetchBuffer;
+	int32 _prefetchOffset;
+	int32 _prefetchSize;
+
+	struct InflatedObject {
+		int32 offset;
+		byte *data;
+	};
+	Common::Array<InflatedObject> _inflatedObjects;
+
 public:
 	SmushPlayer(ScummEngine_v7 *scumm);
 	~SmushPlayer();
@@ -115,6 +127,8 @@ private:
 	void setupAnim(const char *file);
 	void updateScreen();
 	void tryCmpFile(const char *filename);
+	void prefetchNextFrame();
+	void discardPrefetchedFrame();
 
 	bool readString(const char *file);
 	void decodeFrameObject(int codec, const uint8 *src, int left, int top, int width, int height);
@@ -122,6 +136,7 @@ private:
 	void handleFrame(int32 frameSize, Common::SeekableReadStream &);
 	void handleNewPalette(int32 subSize, Common::SeekableReadStream &);
 #ifdef USE_ZLIB
+	byte *inflateFrameObject(const byte *chunk, int32 chunkSize);
 	void handleZlibFrameObject(int32 subSize, Common::SeekableReadStream &b);
 #endif
 	void handleFrameObject(int32 subSize, Common::SeekableReadStream &);
@@ -469,6 +469,15 @@ public:
 	 */
 	virtual void blitSubSurface(const Graphics::Surface *source, const Common::Rect &r) = 0;
 
+	/**
+	 * Copies an area of the current drawing surface into a smaller surface.
+	 *
+	 * This is the inverse of VectorRenderer::blitSubSurface(): the area delimited
+	 * by "r" in the active surface is copied into the top left corner of "dest",
+	 * which must be at least as big as "r".
+	 */
+	virtual void grabSubSurface(Graphics::Surface *dest, const Common::Rect &r) = 0;
+
 	virtual void blitAlphaBitmap(const Graphics::Surface *source, const Common::Rect &r) = 0;
 
 	/**
@@ -485,6 +494,7 @@ public:
 	 */
 	virtual void disableShadows() { _disableShadows = true; }
 	virtual void enableShadows() { _disableShadows = false; }
+	bool shadowsDisabled() const { return _disableShadows; }
 
 	/**
 	 * Applies a whole-screen shading effect, used before opening a new dialog.
@@ -551,6 +551,25 @@ blitSubSurface(const Graphics::Surface *source, const Common::Rect &r) {
 	}
 }
 
+template<typename PixelType>
+void VectorRendererSpec<PixelType>::
+grabSubSurface(Graphics::Surface *dest, const Common::Rect &r) {
+	const byte *src_ptr = (const byte *)_activeSurface->getBasePtr(r.left, r.top);
+	byte *dst_ptr = (byte *)dest->getPixels();
+
+	const int dst_pitch = dest->pitch;
+	const int src_pitch = _activeSurface->pitch;
+
+	int h = r.height();
+	const int w = r.width() * sizeof(PixelType);
+
+	while (h--) {
+		memcpy(dst_ptr, src_ptr, w);
+		dst_ptr += dst_pitch;
+		src_ptr += src_pitch;
+	}
+}
+
 template<typename PixelType>
 void VectorRendererSpec<PixelType>::
 blitAlphaBitmap(const Graphics::Surface *source, const Common::Rect &r) {
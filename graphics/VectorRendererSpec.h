@@ -74,6 +74,7 @@ public:
 	void fillSurface();
 	void blitSurface(const Graphics::Surface *source, const Common::Rect &r);
 	void blitSubSurface(const Graphics::Surface *source, const Common::Rect &r);
+	void grabSubSurface(Graphics::Surface *dest, const Common::Rect &r);
 	void blitAlphaBitmap(const Graphics::Surface *source, const Common::Rect &r);
 
 	void applyScreenShading(GUI::ThemeEngine::ShadingStyle shadingStyle);
@@ -83,6 +83,11 @@ struct WidgetDrawData {
 
 	bool _buffer;
 
+	/** Whether the rendered result of this item may be stored in the draw cache.
+	    Items which draw outside of their area or depend on their absolute
+	    position on the screen are always rendered step by step. */
+	bool _cacheable;
+
 
 	/**
 	 * Calculates the background threshold offset of a given DrawData item.
@@ -90,10 +95,36 @@ struct WidgetDrawData {
 	 * called in order to calculate if such draw steps would be drawn outside of
 	 * the actual widget drawing zone (e.g. shadows). If this is the case, a constant
 	 * value will be added when restoring the background of the widget.
+	 *
+	 * It also decides whether the item can be served from the draw cache.
 	 */
 	void calcBackgroundOffset();
 };
 
+/**
+ * A rendered DrawData item, as stored in the draw cache.
+ *
+ * The result of drawing all the steps of an item only depends on the item
+ * itself, the size of its area, its dynamic data, whether shadows are enabled
+ * and the pixels which were below it before drawing (because of alpha blending
+ * of shadows and anti-aliased borders). Thus both the original background and
+ * the result are stored, and an entry is only reused when the background
+ * matches exactly.
+ */
+struct DrawCacheEntry {
+	const WidgetDrawData *_data;
+	uint32 _dynamicData;
+	bool _shadows;
+
+	Graphics::Surface _background; ///< Pixels of the area before drawing
+	Graphics::Surface _result;     ///< Pixels of the area after drawing
+
+	~DrawCacheEntry() {
+		_background.free();
+		_result.free();
+	}
+};
+
 class ThemeItem {
 
 public:
@@ -232,11 +263,8 @@ void ThemeItemDrawData::drawSelf(bool draw, bool restore) {
 	if (restore)
 		_engine->restoreBackground(extendedRect);
 
-	if (draw) {
-		Common::List<Graphics::DrawStep>::const_iterator step;
-		for (step = _data->_steps.begin(); step != _data->_steps.end(); ++step)
-			_engine->renderer()->drawStep(_area, *step, _dynamicData);
-	}
+	if (draw)
+		_engine->drawDrawData(_data, _area, extendedRect, _dynamicData);
 
 	_engine->addDirtyRect(extendedRect);
 }
@@ -275,6 +303,7 @@ void ThemeItemBitmap::drawSelf(bool draw, bool restore) {
 ThemeEngine::ThemeEngine(Common::String id, GraphicsMode mode) :
 	_system(0), _vectorRenderer(0),
 	_buffering(false), _bytesPerPixel(0),  _graphicsMode(kGfxDisabled),
+	_drawCacheSize(0),
 	_font(0), _initOk(false), _themeOk(false), _enabled(false), _themeFiles(),
 	_cursor(0) {
 
@@ -319,6 +348,7 @@ ThemeEngine::~ThemeEngine() {
 	_vectorRenderer = 0;
 	_screen.free();
 	_backBuffer.free();
+	clearDrawCache();
 
 	unloadTheme();
 
@@ -519,6 +549,9 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 	_screen.free();
 	_screen.create(width, height, _overlayFormat);
 
+	// Cached items have been rendered in the old pixel format.
+	clearDrawCache();
+
 	delete _vectorRenderer;
 	_vectorRenderer = Graphics::createRenderer(mode);
 	_vectorRenderer->setSurface(&_screen);
@@ -532,6 +565,8 @@ void ThemeEngine::setGraphicsMode(GraphicsMode mode) {
 
 void WidgetDrawData::calcBackgroundOffset() {
 	uint maxShadow = 0;
+	_cacheable = true;
+
 	for (Common::List<Graphics::DrawStep>::const_iterator step = _steps.begin();
 	        step != _steps.end(); ++step) {
 		if ((step->autoWidth || step->autoHeight) && step->shadow > maxShadow)
@@ -539,6 +574,14 @@ void WidgetDrawData::calcBackgroundOffset() {
 
 		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_BEVELSQ && step->bevel > maxShadow)
 			maxShadow = step->bevel;
+
+		// Filling the whole surface draws outside of the widget area, and
+		// scaled coordinates depend on the absolute position of the widget.
+		if (step->drawingCall == &Graphics::VectorRenderer::drawCallback_FILLSURFACE)
+			_cacheable = false;
+
+		if (step->scale != (1 << 16) && step->scale != 0)
+			_cacheable = false;
 	}
 
 	_backgroundOffset = maxShadow;
@@ -549,6 +592,87 @@ void ThemeEngine::restoreBackground(Common::Rect r) {
 	_vectorRenderer->blitSurface(&_backBuffer, r);
 }
 
+void ThemeEngine::drawDrawData(const WidgetDrawData *data, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamic) {
+	const uint32 size = extendedRect.width() * extendedRect.height() * _screen.format.bytesPerPixel;
+
+	// Items which do not fit on the screen get clipped while drawing, so
+	// the cache can't hold them. Huge items would evict everything else.
+	if (!data->_cacheable || extendedRect.left < 0 || extendedRect.top < 0
+	        || extendedRect.right > _screen.w || extendedRect.bottom > _screen.h
+	        || extendedRect.isEmpty() || size * 2 > kDrawCacheMaxSize / 2) {
+		Common::List<Graphics::DrawStep>::const_iterator step;
+		for (step = data->_steps.begin(); step != data->_steps.end(); ++step)
+			_vectorRenderer->drawStep(area, *step, dynamic);
+		return;
+	}
+
+	const bool shadows = !_vectorRenderer->shadowsDisabled();
+
+	if (_drawCacheScratch.w != extendedRect.width() || _drawCacheScratch.h != extendedRect.height()) {
+		_drawCacheScratch.free();
+		_drawCacheScratch.create(extendedRect.width(), extendedRect.height(), _screen.format);
+	}
+
+	_vectorRenderer->grabSubSurface(&_drawCacheScratch, extendedRect);
+
+	for (DrawCache::iterator i = _drawCache.begin(); i != _drawCache.end(); ++i) {
+		DrawCacheEntry *entry = *i;
+
+		if (entry->_data != data || entry->_dynamicData != dynamic || entry->_shadows != shadows
+		        || entry->_result.w != extendedRect.width() || entry->_result.h != extendedRect.height())
+			continue;
+
+		if (memcmp(entry->_background.getPixels(), _drawCacheScratch.getPixels(), size))
+			continue;
+
+		_vectorRenderer->blitSubSurface(&entry->_result, extendedRect);
+
+		// Keep the most recently used entries at the front
+		if (i != _drawCache.begin()) {
+			_drawCache.erase(i);
+			_drawCache.push_front(entry);
+		}
+		return;
+	}
+
+	Common::List<Graphics::DrawStep>::const_iterator step;
+	for (step = data->_steps.begin(); step != data->_steps.end(); ++step)
+		_vectorRenderer->drawStep(area, *step, dynamic);
+
+	while (!_drawCache.empty() && _drawCacheSize + size * 2 > kDrawCacheMaxSize) {
+		DrawCacheEntry *entry = _drawCache.back();
+		_drawCacheSize -= entry->_result.pitch * entry->_result.h * 2;
+		_drawCache.pop_back();
+		delete entry;
+	}
+
+	DrawCacheEntry *entry = new DrawCacheEntry;
+	entry->_data = data;
+	entry->_dynamicData = dynamic;
+	entry->_shadows = shadows;
+
+	// The scratch surface becomes the stored background, a new one is
+	// allocated for the next lookup.
+	entry->_background = _drawCacheScratch;
+	_drawCacheScratch = Graphics::Surface();
+
+	entry->_result.create(extendedRect.width(), extendedRect.height(), _screen.format);
+	_vectorRenderer->grabSubSurface(&entry->_result, extendedRect);
+
+	_drawCache.push_front(entry);
+	_drawCacheSize += size * 2;
+}
+
+void ThemeEngine::clearDrawCache() {
+	for (DrawCache::iterator i = _drawCache.begin(); i != _drawCache.end(); ++i)
+		delete *i;
+
+	_drawCache.clear();
+	_drawCacheSize = 0;
+
+	_drawCacheScratch.free();
+}
+
 
 
 /**********************************************************
@@ -712,6 +836,9 @@ void ThemeEngine::unloadTheme() {
 	if (!_themeOk)
 		return;
 
+	// The cache references the DrawData items which are about to be deleted.
+	clearDrawCache();
+
 	for (int i = 0; i < kDrawDataMAX; ++i) {
 		delete _widgets[i];
 		_widgets[i] = 0;
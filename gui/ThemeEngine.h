@@ -48,6 +48,7 @@ class VectorRenderer;
 namespace GUI {
 
 struct WidgetDrawData;
+struct DrawCacheEntry;
 struct TextDrawData;
 struct TextColorData;
 class Dialog;
@@ -523,6 +524,18 @@ public:
 	 */
 	void restoreBackground(Common::Rect r);
 
+	/**
+	 * Draws all the DrawSteps of a DrawData item on the active drawing surface.
+	 * Results are kept in a bounded cache, so redrawing an item with the same
+	 * size on the same background is a single blit.
+	 *
+	 * @param data DrawData item to draw.
+	 * @param area Area of the widget.
+	 * @param extendedRect Area of the widget, including its shadows and bevels.
+	 * @param dynamic Dynamic data of the item (e.g. triangle orientation).
+	 */
+	void drawDrawData(const WidgetDrawData *data, const Common::Rect &area, const Common::Rect &extendedRect, uint32 dynamic);
+
 	const Common::String &getThemeName() const { return _themeName; }
 	const Common::String &getThemeId() const { return _themeId; }
 	int getGraphicsMode() const { return _graphicsMode; }
@@ -632,6 +645,23 @@ protected:
 	/** Backbuffer surface. Stores previous states of the screen to blit back */
 	Graphics::Surface _backBuffer;
 
+	/** Maximum amount of pixel data kept in the draw cache, in bytes */
+	static const uint32 kDrawCacheMaxSize = 4 * 1024 * 1024;
+
+	typedef Common::List<DrawCacheEntry *> DrawCache;
+
+	/** Rendered DrawData items, most recently used first */
+	DrawCache _drawCache;
+
+	/** Amount of pixel data currently held by the draw cache, in bytes */
+	uint32 _drawCacheSize;
+
+	/** Scratch surface used to grab the background below an item */
+	Graphics::Surface _drawCacheScratch;
+
+	/** Empties the draw cache. */
+	void clearDrawCache();
+
 	/** Sets whether the current drawing is being buffered (stored for later
 	    processing) or drawn directly to the screen. */
 	bool _buffering;
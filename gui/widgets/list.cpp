@@ -164,6 +164,15 @@ void ListWidget::setList(const StringArray &list, const ColorList *colors) {
 	_listIndex.clear();
 	_listColors.clear();
 
+	// Keep lowercase copies of all entries around, so filtering does not
+	// have to convert every entry again on each key press.
+	_lowercaseDataList.clear();
+	_lowercaseDataList.reserve(list.size());
+	for (StringArray::const_iterator i = list.begin(); i != list.end(); ++i) {
+		_lowercaseDataList.push_back(*i);
+		_lowercaseDataList.back().toLowercase();
+	}
+
 	if (colors) {
 		_listColors = *colors;
 		assert(_listColors.size() == _dataList.size());
@@ -196,6 +205,9 @@ void ListWidget::append(const String &s, ThemeEngine::FontColor color) {
 	_dataList.push_back(s);
 	_list.push_back(s);
 
+	_lowercaseDataList.push_back(s);
+	_lowercaseDataList.back().toLowercase();
+
 	setFilter(_filter, false);
 
 	scrollBarRecalc();
@@ -679,6 +691,12 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 	if (_filter == filt) // Filter was not changed
 		return;
 
+	// When the new filter only extends the old one (the usual case while
+	// typing), every word of the old filter is still contained in a word of
+	// the new one. Thus only the entries matching the old filter need to be
+	// checked again.
+	const bool refine = !_filter.empty() && filt.hasPrefix(_filter);
+
 	_filter = filt;
 
 	if (_filter.empty()) {
@@ -690,15 +708,21 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 		// as substrings, ignoring case.
 
 		Common::StringTokenizer tok(_filter);
-		String tmp;
-		int n = 0;
+		Common::Array<int> candidates;
+
+		if (refine) {
+			candidates = _listIndex;
+		} else {
+			candidates.reserve(_dataList.size());
+			for (uint n = 0; n < _dataList.size(); ++n)
+				candidates.push_back(n);
+		}
 
 		_list.clear();
 		_listIndex.clear();
 
-		for (StringArray::iterator i = _dataList.begin(); i != _dataList.end(); ++i, ++n) {
-			tmp = *i;
-			tmp.toLowercase();
+		for (Common::Array<int>::const_iterator i = candidates.begin(); i != candidates.end(); ++i) {
+			const String &tmp = _lowercaseDataList[*i];
 			bool matches = true;
 			tok.reset();
 			while (!tok.empty()) {
@@ -709,8 +733,8 @@ void ListWidget::setFilter(const String &filter, bool redraw) {
 			}
 
 			if (matches) {
-				_list.push_back(*i);
-				_listIndex.push_back(n);
+				_list.push_back(_dataList[*i]);
+				_listIndex.push_back(*i);
 			}
 		}
 	}
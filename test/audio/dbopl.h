@@ -0,0 +1,112 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/softsynth/opl/dosbox.h"
+#include "common/util.h"
+
+#include "helper.h"
+
+/**
+ * Renders a fixed register program through the DOSBox OPL emulator and
+ * compares a hash of the output, to make sure optimizations of the
+ * emulator do not change its output.
+ */
+class DBOPLTestSuite : public CxxTest::TestSuite {
+#ifndef DISABLE_DOSBOX_OPL
+	static void setupChannel(OPL::OPL *opl, int bank, int channel, int seed) {
+		static const int opOffsets[9] = { 0, 1, 2, 8, 9, 10, 16, 17, 18 };
+		const int base = bank ? 0x100 : 0;
+		const int op = opOffsets[channel];
+
+		for (int i = 0; i < 2; i++) {
+			const int n = seed + i * 3;
+			opl->writeReg(base + 0x20 + op + i * 3, 0x01 + (n % 4) + ((n & 1) ? 0x80 : 0) + ((n & 2) ? 0x40 : 0) + ((n & 4) ? 0x20 : 0) + ((n & 8) ? 0x10 : 0));
+			opl->writeReg(base + 0x40 + op + i * 3, i ? (n & 0x0F) : (0x10 + (n * 7) % 0x30) | ((n & 3) << 6));
+			opl->writeReg(base + 0x60 + op + i * 3, 0xF0 - (n % 5) * 0x20 + 0x02 + (n % 7));
+			opl->writeReg(base + 0x80 + op + i * 3, 0x13 + ((n * 5) % 0xC) * 0x10 + (n % 3));
+			opl->writeReg(base + 0xE0 + op + i * 3, n % 8);
+		}
+
+		opl->writeReg(base + 0xC0 + channel, 0x30 | ((seed % 7) << 1) | (seed & 1));
+	}
+
+	static void keyOn(OPL::OPL *opl, int bank, int channel, int note, bool on) {
+		const int base = bank ? 0x100 : 0;
+		const int fnum = 0x157 + note * 0x21;
+		opl->writeReg(base + 0xA0 + channel, fnum & 0xFF);
+		opl->writeReg(base + 0xB0 + channel, ((fnum >> 8) & 3) | ((2 + note % 4) << 2) | (on ? 0x20 : 0));
+	}
+
+	static uint32 render(OPL::OPL *opl, uint32 hash, int samples) {
+		const int channels = opl->isStereo() ? 2 : 1;
+		int16 buffer[512 * 2];
+
+		while (samples > 0) {
+			const int step = MIN(samples, 512);
+			opl->readBuffer(buffer, step * channels);
+			hash = hashSamples(hash, buffer, step * channels);
+			samples -= step;
+		}
+
+		return hash;
+	}
+
+	static uint32 renderProgram(OPL::Config::OplType type) {
+		OPL::DOSBox::OPL opl(type);
+		opl.init(44100);
+
+		const int banks = (type == OPL::Config::kOpl3) ? 2 : 1;
+		uint32 hash = kHashSamplesStart;
+
+		opl.writeReg(0x01, 0x20);
+		if (type == OPL::Config::kOpl3) {
+			opl.writeReg(0x105, 0x01);
+			// Two 4-operator channel pairs in each bank
+			opl.writeReg(0x104, 0x1B);
+		}
+
+		// Deep tremolo and vibrato
+		opl.writeReg(0xBD, 0xC0);
+
+		for (int bank = 0; bank < banks; bank++)
+			for (int ch = 0; ch < 9; ch++)
+				setupChannel(&opl, bank, ch, bank * 9 + ch);
+
+		for (int step = 0; step < 24; step++) {
+			for (int bank = 0; bank < banks; bank++)
+				for (int ch = 0; ch < 9; ch++)
+					keyOn(&opl, bank, ch, (step + ch * 3 + bank) % 12, ((step + ch) % 3) != 0);
+
+			// Switch to percussion mode for a while
+			if (step == 12)
+				opl.writeReg(0xBD, 0xE0 | 0x1F);
+			else if (step == 16)
+				opl.writeReg(0xBD, 0xE0 | 0x05);
+			else if (step == 20)
+				opl.writeReg(0xBD, 0x00);
+
+			hash = render(&opl, hash, 2205 + step * 31);
+		}
+
+		return hash;
+	}
+#endif
+
+	public:
+	void test_opl2_output() {
+#ifndef DISABLE_DOSBOX_OPL
+		TS_ASSERT_EQUALS(renderProgram(OPL::Config::kOpl2), 3768358301u);
+#endif
+	}
+
+	void test_dual_opl2_output() {
+#ifndef DISABLE_DOSBOX_OPL
+		TS_ASSERT_EQUALS(renderProgram(OPL::Config::kDualOpl2), 4285228208u);
+#endif
+	}
+
+	void test_opl3_output() {
+#ifndef DISABLE_DOSBOX_OPL
+		TS_ASSERT_EQUALS(renderProgram(OPL::Config::kOpl3), 1250851737u);
+#endif
+	}
+};
@@ -65,4 +65,20 @@ static Audio::SeekableAudioStream *createSineStream(const int sampleRate, const
 	return s;
 }
 
+/** The FNV-1a offset basis, to start a new hash for hashSamples() with */
+static const uint32 kHashSamplesStart = 2166136261u;
+
+/**
+ * Continue an FNV-1a hash over the little endian bytes of the samples,
+ * e.g. to compare the output of an emulator with a known good hash.
+ */
+static uint32 hashSamples(uint32 hash, const int16 *samples, int count) {
+	for (int i = 0; i < count; i++) {
+		hash = (hash ^ (samples[i] & 0xFF)) * 16777619;
+		hash = (hash ^ ((samples[i] >> 8) & 0xFF)) * 16777619;
+	}
+
+	return hash;
+}
+
 #endif
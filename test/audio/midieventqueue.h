@@ -0,0 +1,73 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/midieventqueue.h"
+
+class MidiEventQueueTestSuite : public CxxTest::TestSuite
+{
+public:
+	void test_order() {
+		MidiEventQueue queue(4);
+		TS_ASSERT(queue.empty());
+		TS_ASSERT(!queue.peek());
+
+		const byte sysEx[] = { 0x41, 0x10, 0x16, 0x12 };
+		TS_ASSERT(queue.pushMessage(0x403C90));
+		TS_ASSERT(queue.pushSysEx(sysEx, sizeof(sysEx)));
+		TS_ASSERT(queue.pushMessage(0x003C80));
+
+		const MidiEventQueue::Event *event = queue.peek();
+		TS_ASSERT(event);
+		TS_ASSERT_EQUALS(event->message, 0x403C90u);
+		TS_ASSERT(!event->sysExData);
+		queue.pop();
+
+		event = queue.peek();
+		TS_ASSERT(event);
+		TS_ASSERT_EQUALS(event->sysExLength, sizeof(sysEx));
+		TS_ASSERT_EQUALS(memcmp(event->sysExData, sysEx, sizeof(sysEx)), 0);
+		queue.pop();
+
+		event = queue.peek();
+		TS_ASSERT(event);
+		TS_ASSERT_EQUALS(event->message, 0x003C80u);
+		queue.pop();
+
+		TS_ASSERT(queue.empty());
+	}
+
+	void test_full() {
+		MidiEventQueue queue(2);
+
+		TS_ASSERT(queue.pushMessage(1));
+		TS_ASSERT(queue.pushMessage(2));
+		TS_ASSERT(!queue.pushMessage(3));
+
+		queue.pop();
+		TS_ASSERT(queue.pushMessage(3));
+		TS_ASSERT_EQUALS(queue.peek()->message, 2u);
+	}
+
+	void test_wrap() {
+		MidiEventQueue queue(3);
+		const byte sysEx[] = { 1, 2, 3 };
+
+		// Reuse every slot several times, replacing SysEx data with short
+		// messages and vice versa
+		for (uint32 i = 0; i < 20; ++i) {
+			bool pushed;
+			if (i & 1)
+				pushed = queue.pushSysEx(sysEx, sizeof(sysEx));
+			else
+				pushed = queue.pushMessage(i);
+			TS_ASSERT(pushed);
+
+			const MidiEventQueue::Event *event = queue.peek();
+			TS_ASSERT(event);
+			TS_ASSERT_EQUALS(event->message, (i & 1) ? 0u : i);
+			TS_ASSERT_EQUALS(event->sysExData != 0, (i & 1) != 0);
+			queue.pop();
+		}
+
+		TS_ASSERT(queue.empty());
+	}
+};
@@ -0,0 +1,76 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/softsynth/sid.h"
+
+#include "helper.h"
+
+/**
+ * Renders a fixed register program through the reSID emulator and compares
+ * a hash of the output, to make sure optimizations of the emulator do not
+ * change its output.
+ */
+class SIDTestSuite : public CxxTest::TestSuite {
+#ifndef DISABLE_SID
+	static uint32 renderProgram(Resid::sampling_method method) {
+		static const byte waveforms[] = { 0x10, 0x20, 0x40, 0x80, 0x30, 0x50, 0x60, 0x70, 0x14, 0x42, 0x22, 0x12 };
+
+		Resid::SID sid;
+		sid.set_sampling_parameters(985248, method, 44100);
+		sid.enable_filter(true);
+		sid.reset();
+
+		uint32 hash = kHashSamplesStart;
+		int16 buffer[2048];
+		Resid::cycle_count cyclesLeft = 0;
+
+		// Five seconds of notes of all waveforms on the three voices,
+		// including hard sync and ring modulation, with a sweeping filter
+		for (int frame = 0; frame < 250; frame++) {
+			for (int v = 0; v < 3; v++) {
+				const int reg = v * 7;
+				const int n = frame / (4 + v) + v * 5;
+
+				if (frame % (4 + v) == 0) {
+					const int freq = 0x0400 + ((n * 2719 + v * 1237) & 0x3FFF);
+					sid.write(reg + 0, freq & 0xFF);
+					sid.write(reg + 1, freq >> 8);
+					sid.write(reg + 2, (n * 37) & 0xFF);
+					sid.write(reg + 3, (n >> 2) & 0x0F);
+					sid.write(reg + 5, ((n * 3) & 0x0F) << 4 | ((n * 5) & 0x0F));
+					sid.write(reg + 6, ((n * 7 + 8) & 0x0F) << 4 | ((n * 11) & 0x0F));
+					sid.write(reg + 4, waveforms[n % ARRAYSIZE(waveforms)] | 1);
+				} else if (frame % (4 + v) == 2) {
+					sid.write(reg + 4, waveforms[n % ARRAYSIZE(waveforms)]);
+				}
+			}
+
+			const int cutoff = (frame * 13) & 0x7FF;
+			sid.write(0x15, cutoff & 7);
+			sid.write(0x16, cutoff >> 3);
+			sid.write(0x17, ((frame / 50) & 0x0F) << 4 | ((frame / 25) & 7));
+			sid.write(0x18, ((frame / 40) & 7) << 4 | 0x0F);
+
+			cyclesLeft += 19656;
+			while (cyclesLeft > 0) {
+				const int count = sid.updateClock(cyclesLeft, buffer, ARRAYSIZE(buffer));
+				hash = hashSamples(hash, buffer, count);
+			}
+		}
+
+		return hash;
+	}
+#endif
+
+	public:
+	void test_fast_output() {
+#ifndef DISABLE_SID
+		TS_ASSERT_EQUALS(renderProgram(Resid::SAMPLE_FAST), 1695455591u);
+#endif
+	}
+
+	void test_interpolate_output() {
+#ifndef DISABLE_SID
+		TS_ASSERT_EQUALS(renderProgram(Resid::SAMPLE_INTERPOLATE), 3796911814u);
+#endif
+	}
+};
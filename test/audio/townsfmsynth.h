@@ -0,0 +1,222 @@
+#include <cxxtest/TestSuite.h>
+
+#include "audio/mixer.h"
+#include "audio/softsynth/fmtowns_pc98/towns_pc98_fmsynth.h"
+#include "common/system.h"
+#include "common/list.h"
+#include "graphics/pixelformat.h"
+
+#include "helper.h"
+
+/**
+ * Just enough of a system for TownsPC98_FmSynth: its Common::Mutex needs
+ * the mutex functions, everything else is never called.
+ */
+class TownsFmSynthTestSystem : public OSystem {
+public:
+	virtual const GraphicsMode *getSupportedGraphicsModes() const { return 0; }
+	virtual int getDefaultGraphicsMode() const { return 0; }
+	virtual bool setGraphicsMode(int mode) { return false; }
+	virtual int getGraphicsMode() const { return 0; }
+	virtual Graphics::PixelFormat getScreenFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	virtual Common::List<Graphics::PixelFormat> getSupportedFormats() const { return Common::List<Graphics::PixelFormat>(); }
+	virtual void initSize(uint width, uint height, const Graphics::PixelFormat *format) {}
+	virtual int16 getHeight() { return 0; }
+	virtual int16 getWidth() { return 0; }
+	virtual PaletteManager *getPaletteManager() { return 0; }
+	virtual void copyRectToScreen(const void *buf, int pitch, int x, int y, int w, int h) {}
+	virtual Graphics::Surface *lockScreen() { return 0; }
+	virtual void unlockScreen() {}
+	virtual void fillScreen(uint32 col) {}
+	virtual void updateScreen() {}
+	virtual void setShakePos(int shakeOffset) {}
+	virtual void showOverlay() {}
+	virtual void hideOverlay() {}
+	virtual Graphics::PixelFormat getOverlayFormat() const { return Graphics::PixelFormat::createFormatCLUT8(); }
+	virtual void clearOverlay() {}
+	virtual void grabOverlay(void *buf, int pitch) {}
+	virtual void copyRectToOverlay(const void *buf, int pitch, int x, int y, int w, int h) {}
+	virtual int16 getOverlayHeight() { return 0; }
+	virtual int16 getOverlayWidth() { return 0; }
+	virtual bool showMouse(bool visible) { return false; }
+	virtual void warpMouse(int x, int y) {}
+	virtual void setMouseCursor(const void *buf, uint w, uint h, int hotspotX, int hotspotY, uint32 keycolor, bool dontScale, const Graphics::PixelFormat *format) {}
+	virtual uint32 getMillis(bool skipRecord) { return 0; }
+	virtual void delayMillis(uint msecs) {}
+	virtual void getTimeAndDate(TimeDate &t) const {}
+	virtual MutexRef createMutex() { return (MutexRef)this; }
+	virtual void lockMutex(MutexRef mutex) {}
+	virtual void unlockMutex(MutexRef mutex) {}
+	virtual void deleteMutex(MutexRef mutex) {}
+	virtual Audio::Mixer *getMixer() { return 0; }
+	virtual void quit() {}
+	virtual void displayMessageOnOSD(const char *msg) {}
+	virtual void logMessage(LogMessageType::Type type, const char *message) {}
+};
+
+/**
+ * A mixer which only reports its output rate. The test pulls the samples
+ * from the synth itself.
+ */
+class TownsFmSynthTestMixer : public Audio::Mixer {
+public:
+	virtual bool isReady() const { return true; }
+	virtual void playStream(SoundType type, Audio::SoundHandle *handle, Audio::AudioStream *stream,
+		int id, byte volume, int8 balance, DisposeAfterUse::Flag autofreeStream, bool permanent, bool reverseStereo) {}
+	virtual void stopAll() {}
+	virtual void stopID(int id) {}
+	virtual void stopHandle(Audio::SoundHandle handle) {}
+	virtual void pauseAll(bool paused) {}
+	virtual void pauseID(int id, bool paused) {}
+	virtual void pauseHandle(Audio::SoundHandle handle, bool paused) {}
+	virtual bool isSoundIDActive(int id) { return false; }
+	virtual int getSoundID(Audio::SoundHandle handle) { return 0; }
+	virtual bool isSoundHandleActive(Audio::SoundHandle handle) { return false; }
+	virtual void muteSoundType(SoundType type, bool mute) {}
+	virtual bool isSoundTypeMuted(SoundType type) const { return false; }
+	virtual void setChannelVolume(Audio::SoundHandle handle, byte volume) {}
+	virtual byte getChannelVolume(Audio::SoundHandle handle) { return 0; }
+	virtual void setChannelBalance(Audio::SoundHandle handle, int8 balance) {}
+	virtual int8 getChannelBalance(Audio::SoundHandle handle) { return 0; }
+	virtual uint32 getSoundElapsedTime(Audio::SoundHandle handle) { return 0; }
+	virtual Audio::Timestamp getElapsedTime(Audio::SoundHandle handle) { return Audio::Timestamp(); }
+	virtual bool hasActiveChannelOfType(SoundType type) { return false; }
+	virtual void setVolumeForSoundType(SoundType type, int volume) {}
+	virtual int getVolumeForSoundType(SoundType type) const { return 0; }
+	virtual uint getOutputRate() const { return 44100; }
+};
+
+class TownsFmSynthTestDriver : public TownsPC98_FmSynth {
+public:
+	TownsFmSynthTestDriver(Audio::Mixer *mixer, EmuType type) : TownsPC98_FmSynth(mixer, type), _timerCount(0) {}
+
+	int _timerCount;
+
+protected:
+	void timerCallbackA() { _timerCount++; }
+	void timerCallbackB() { _timerCount++; }
+};
+
+/**
+ * Renders a fixed register program through the FM-Towns/PC-98 FM synth
+ * and compares a hash of the output, to make sure optimizations of the
+ * emulator do not change its output.
+ */
+class TownsFmSynthTestSuite : public CxxTest::TestSuite {
+	static void setupChannel(TownsPC98_FmSynth *synth, int part, int channel, int seed) {
+		for (int op = 0; op < 4; op++) {
+			const int reg = op * 4 + channel;
+			const int n = seed * 4 + op;
+			synth->writeReg(part, 0x30 + reg, ((n % 8) << 4) | (1 + n % 7));
+			synth->writeReg(part, 0x40 + reg, (op == 3) ? (0x14 + n % 8) : (0x08 + (n * 11) % 0x30));
+			synth->writeReg(part, 0x50 + reg, ((n & 3) << 6) | (0x1F - n % 6));
+			synth->writeReg(part, 0x60 + reg, 0x04 + n % 9);
+			synth->writeReg(part, 0x70 + reg, n % 5);
+			synth->writeReg(part, 0x80 + reg, ((n * 3) % 16) << 4 | (0x05 + n % 11));
+		}
+
+		synth->writeReg(part, 0xB0 + channel, ((seed % 8) << 3) | (seed % 8));
+		synth->writeReg(part, 0xB4 + channel, (seed % 3 == 1) ? 0x80 : ((seed % 3 == 2) ? 0x40 : 0xC0));
+	}
+
+	static void keyOn(TownsPC98_FmSynth *synth, int part, int channel, int note, bool on) {
+		const int frq = ((2 + note % 5) << 11) | (0x26A + note * 0x29);
+		synth->writeReg(part, 0xA4 + channel, frq >> 8);
+		synth->writeReg(part, 0xA0 + channel, frq & 0xFF);
+		synth->writeReg(0, 0x28, (on ? 0xF0 : 0x00) | (part << 2) | channel);
+	}
+
+	static uint32 render(TownsPC98_FmSynth *synth, uint32 hash, int samples) {
+		int16 buffer[512 * 2];
+
+		while (samples > 0) {
+			const int step = MIN(samples, 512);
+			synth->readBuffer(buffer, step * 2);
+			hash = hashSamples(hash, buffer, step * 2);
+			samples -= step;
+		}
+
+		return hash;
+	}
+
+	static uint32 renderProgram(TownsPC98_FmSynth::EmuType type) {
+		TownsFmSynthTestSystem system;
+		TownsFmSynthTestMixer mixer;
+		OSystem *oldSystem = g_system;
+		g_system = &system;
+
+		uint32 hash = kHashSamplesStart;
+		{
+			TownsFmSynthTestDriver synth(&mixer, type);
+			synth.init();
+
+			const int parts = (type == TownsPC98_FmSynth::kType26) ? 1 : 2;
+			for (int part = 0; part < parts; part++)
+				for (int ch = 0; ch < 3; ch++)
+					setupChannel(&synth, part, ch, part * 3 + ch);
+
+			// Run both timers, so the timer callbacks split the render blocks
+			synth.writeReg(0, 0x24, 0xF0);
+			synth.writeReg(0, 0x25, 0x01);
+			synth.writeReg(0, 0x26, 0xC8);
+			synth.writeReg(0, 0x27, 0x33);
+
+			if (type != TownsPC98_FmSynth::kTypeTowns) {
+				// SSG tones, noise and a repeating envelope
+				synth.writeReg(0, 0x06, 0x0B);
+				synth.writeReg(0, 0x07, 0x31);
+				synth.writeReg(0, 0x08, 0x0C);
+				synth.writeReg(0, 0x09, 0x10);
+				synth.writeReg(0, 0x0A, 0x09);
+				synth.writeReg(0, 0x0B, 0x40);
+				synth.writeReg(0, 0x0C, 0x02);
+				synth.writeReg(0, 0x0D, 0x0E);
+			}
+
+			if (type == TownsPC98_FmSynth::kType86) {
+				synth.writeReg(0, 0x11, 0x30);
+				for (int i = 0; i < 6; i++)
+					synth.writeReg(0, 0x18 + i, 0xC0 | (0x10 + i * 2));
+			}
+
+			for (int step = 0; step < 32; step++) {
+				for (int part = 0; part < parts; part++)
+					for (int ch = 0; ch < 3; ch++)
+						keyOn(&synth, part, ch, (step + ch * 4 + part * 2) % 16, ((step + ch + part) % 4) != 0);
+
+				if (type != TownsPC98_FmSynth::kTypeTowns) {
+					for (int ch = 0; ch < 3; ch++) {
+						const int period = 0x80 + ((step * 7 + ch * 5) % 24) * 0x1D;
+						synth.writeReg(0, ch * 2, period & 0xFF);
+						synth.writeReg(0, ch * 2 + 1, period >> 8);
+					}
+				}
+
+				if (type == TownsPC98_FmSynth::kType86 && (step % 2) == 0)
+					synth.writeReg(0, 0x10, 1 << ((step / 2) % 6));
+
+				hash = render(&synth, hash, 2205 + step * 31);
+			}
+
+			TS_ASSERT(synth._timerCount > 0);
+		}
+
+		g_system = oldSystem;
+		return hash;
+	}
+
+	public:
+	void test_towns_output() {
+		TS_ASSERT_EQUALS(renderProgram(TownsPC98_FmSynth::kTypeTowns), 2250508036u);
+	}
+
+	void test_type26_output() {
+		TS_ASSERT_EQUALS(renderProgram(TownsPC98_FmSynth::kType26), 1097861773u);
+	}
+
+	void test_type86_output() {
+#ifndef DISABLE_PC98_RHYTHM_CHANNEL
+		TS_ASSERT_EQUALS(renderProgram(TownsPC98_FmSynth::kType86), 2663124521u);
+#endif
+	}
+};
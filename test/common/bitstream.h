@@ -149,4 +149,69 @@ class BitStreamTestSuite : public CxxTest::TestSuite
 		TS_ASSERT_EQUALS(bs.peekBits(5), 12u);
 		TS_ASSERT(!bs.eos());
 	}
+
+	void test_get_bits_32() {
+		byte contents[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC };
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		Common::BitStream8MSB bs(ms);
+		bs.skip(1);
+		TS_ASSERT_EQUALS(bs.getBits(32), 610839793u);
+		TS_ASSERT_EQUALS(bs.pos(), 33u);
+
+		bs.rewind();
+		bs.skip(25);
+		TS_ASSERT_EQUALS(bs.pos(), 25u);
+		TS_ASSERT_EQUALS(bs.getBits(4), 15u);
+		TS_ASSERT_EQUALS(bs.pos(), 29u);
+	}
+
+	void test_get_bits_32_lsb() {
+		byte contents[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC };
+
+		Common::MemoryReadStream ms(contents, sizeof(contents));
+
+		Common::BitStream8LSB bs(ms);
+		bs.skip(1);
+		TS_ASSERT_EQUALS(bs.getBits(32), 1009457673u);
+		TS_ASSERT_EQUALS(bs.pos(), 33u);
+
+		bs.rewind();
+		bs.skip(25);
+		TS_ASSERT_EQUALS(bs.pos(), 25u);
+		TS_ASSERT_EQUALS(bs.getBits(4), 12u);
+		TS_ASSERT_EQUALS(bs.pos(), 29u);
+	}
+
+	/**
+	 * Peeks within the current 32-bit value and across values have to
+	 * return what reading the bits would return.
+	 */
+	void test_peek_bits_32bit_values() {
+		checkPeekBits<Common::BitStream32LEMSB>();
+		checkPeekBits<Common::BitStream32LELSB>();
+	}
+
+	private:
+	template<class BS>
+	void checkPeekBits() {
+		byte contents[] = { 0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0, 0x0F, 0xED, 0xCB, 0xA9 };
+		const uint8 counts[] = { 3, 9, 1, 19, 7, 16, 9, 32 };
+
+		Common::MemoryReadStream ms1(contents, sizeof(contents));
+		Common::MemoryReadStream ms2(contents, sizeof(contents));
+
+		BS peeked(ms1);
+		BS read(ms2);
+
+		for (uint i = 0; i < ARRAYSIZE(counts); i++) {
+			if (peeked.pos() + counts[i] > peeked.size())
+				break;
+
+			TS_ASSERT_EQUALS(peeked.peekBits(counts[i]), read.getBits(counts[i]));
+			peeked.skip(counts[i]);
+			TS_ASSERT_EQUALS(peeked.pos(), read.pos());
+		}
+	}
 };
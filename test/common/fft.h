@@ -0,0 +1,114 @@
+#include <cxxtest/TestSuite.h>
+
+#include "common/fft.h"
+#include "common/rdft.h"
+#include "common/dct.h"
+
+#include <math.h>
+
+/**
+ * Checks the FFT, RDFT and DCT against a straightforward O(n^2)
+ * evaluation of the transforms in double precision.
+ */
+class FFTTestSuite : public CxxTest::TestSuite {
+	static double input(int i) {
+		return sin(i * 0.9) + 0.05 * i - cos(i * 2.3) * 0.5;
+	}
+
+	public:
+	void test_fft() {
+		for (int bits = 2; bits <= 10; bits++) {
+			const int n = 1 << bits;
+
+			Common::Complex *z = new Common::Complex[n];
+			for (int i = 0; i < n; i++) {
+				z[i].re = input(i);
+				z[i].im = input(n - i) * 0.5;
+			}
+
+			Common::FFT fft(bits, 0);
+			fft.permute(z);
+			fft.calc(z);
+
+			for (int k = 0; k < n; k++) {
+				double re = 0.0, im = 0.0;
+				for (int i = 0; i < n; i++) {
+					const double a = -2 * M_PI * i * k / n;
+					re += input(i) * cos(a) - input(n - i) * 0.5 * sin(a);
+					im += input(i) * sin(a) + input(n - i) * 0.5 * cos(a);
+				}
+
+				TS_ASSERT_DELTA(z[k].re, re, 0.001 * n);
+				TS_ASSERT_DELTA(z[k].im, im, 0.001 * n);
+			}
+
+			delete[] z;
+		}
+	}
+
+	void test_rdft() {
+		for (int bits = 4; bits <= 10; bits++) {
+			const int n = 1 << bits;
+
+			float *data = new float[n];
+			for (int i = 0; i < n; i++)
+				data[i] = input(i);
+
+			Common::RDFT rdft(bits, Common::RDFT::DFT_R2C);
+			rdft.calc(data);
+
+			// The real Nyquist term is packed into the imaginary part of the DC term
+			for (int k = 0; k < n / 2; k++) {
+				double re = 0.0, im = 0.0, nyquist = 0.0;
+				for (int i = 0; i < n; i++) {
+					const double a = -2 * M_PI * i * k / n;
+					re += input(i) * cos(a);
+					im += input(i) * sin(a);
+					nyquist += (i & 1) ? -input(i) : input(i);
+				}
+
+				TS_ASSERT_DELTA(data[2 * k], re, 0.001 * n);
+				TS_ASSERT_DELTA(data[2 * k + 1], (k == 0) ? nyquist : im, 0.001 * n);
+			}
+
+			// And back again
+			Common::RDFT irdft(bits, Common::RDFT::IDFT_C2R);
+			irdft.calc(data);
+
+			for (int i = 0; i < n; i++)
+				TS_ASSERT_DELTA(data[i] * 2 / n, input(i), 0.001);
+
+			delete[] data;
+		}
+	}
+
+	void test_dct() {
+		for (int bits = 4; bits <= 10; bits++) {
+			const int n = 1 << bits;
+
+			float *data = new float[n];
+			for (int i = 0; i < n; i++)
+				data[i] = input(i);
+
+			Common::DCT dct(bits, Common::DCT::DCT_II);
+			dct.calc(data);
+
+			for (int k = 0; k < n; k++) {
+				double sum = 0.0;
+				for (int i = 0; i < n; i++)
+					sum += input(i) * cos(M_PI / n * (i + 0.5) * k);
+
+				TS_ASSERT_DELTA(data[k], sum, 0.001 * n);
+			}
+
+			// DCT-III is the inverse of DCT-II
+			Common::DCT idct(bits, Common::DCT::DCT_III);
+			idct.calc(data);
+
+			for (int i = 0; i < n; i++)
+				TS_ASSERT_DELTA(data[i], input(i), 0.001);
+
+			delete[] data;
+		}
+	}
+};
@@ -141,4 +141,76 @@ class HuffmanTestSuite : public CxxTest::TestSuite {
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[5]);
 		TS_ASSERT_EQUALS(h.getSymbol(bs), expected[6]);
 	}
+
+	/**
+	 * Encodes a long pseudo-random message with codes both shorter and
+	 * longer than the lookup tables, and decodes it again. This covers
+	 * the table lookup, the bitwise search for long codes and the end of
+	 * the stream, with both bit orders.
+	 *
+	 * Encoding (bits in stream order):
+	 * 0...10 = i ones followed by a zero
+	 * 11     = 11 ones
+	 */
+	void test_long_codes_msb() {
+		roundTrip(true);
+	}
+
+	void test_long_codes_lsb() {
+		roundTrip(false);
+	}
+
+	private:
+	void roundTrip(bool msb) {
+		const uint32 codeCount = 12;
+		const uint32 symbolCount = 4000;
+
+		uint8 lengths[codeCount];
+		uint32 codes[codeCount];
+
+		for (uint32 i = 0; i < codeCount - 1; i++) {
+			// The ones followed by a zero, as collected by BitStream::addBit()
+			lengths[i] = i + 1;
+			codes[i] = msb ? (((1 << i) - 1) << 1) : ((1 << i) - 1);
+		}
+
+		lengths[codeCount - 1] = codeCount - 1;
+		codes[codeCount - 1] = (1 << (codeCount - 1)) - 1;
+
+		Common::Huffman h(0, codeCount, codes, lengths);
+
+		byte input[symbolCount * 2];
+		memset(input, 0, sizeof(input));
+
+		uint32 expected[symbolCount];
+		uint32 seed = 1;
+		uint32 bitPos = 0;
+
+		for (uint32 i = 0; i < symbolCount; i++) {
+			seed = seed * 1103515245 + 12345;
+			expected[i] = (seed >> 16) % codeCount;
+
+			const uint32 symbol = expected[i];
+			for (uint32 j = 0; j < lengths[symbol]; j++, bitPos++) {
+				// Every code is a run of ones, terminated by a zero unless it's the last code
+				const bool one = (j < symbol);
+				if (one)
+					input[bitPos >> 3] |= msb ? (0x80 >> (bitPos & 7)) : (1 << (bitPos & 7));
+			}
+		}
+
+		Common::MemoryReadStream ms(input, (bitPos + 7) >> 3);
+		Common::BitStream *bs;
+		if (msb)
+			bs = new Common::BitStream8MSB(ms);
+		else
+			bs = new Common::BitStream8LSB(ms);
+
+		for (uint32 i = 0; i < symbolCount; i++)
+			TS_ASSERT_EQUALS(h.getSymbol(*bs), expected[i]);
+
+		TS_ASSERT_EQUALS(bs->pos(), bitPos);
+
+		delete bs;
+	}
 };
@@ -0,0 +1,135 @@
+#include <cxxtest/TestSuite.h>
+
+#include "video/dsp.h"
+
+#include <math.h>
+
+/**
+ * Checks the shared video DSP kernels against the plain per-pixel
+ * formulas they replace.
+ */
+class VideoDSPTestSuite : public CxxTest::TestSuite {
+	enum {
+		kPitch = 40
+	};
+
+	byte _src[kPitch * 20];
+
+	void fillSource() {
+		uint32 seed = 12345;
+		for (int i = 0; i < kPitch * 20; i++) {
+			seed = seed * 1103515245 + 12345;
+			_src[i] = (seed >> 16) & 0xFF;
+		}
+	}
+
+	public:
+	void test_put_pixels() {
+		fillSource();
+
+		byte dst[kPitch * 16];
+		Video::DSP::putPixels16(dst, _src + 3, kPitch, 16);
+		for (int y = 0; y < 16; y++)
+			for (int x = 0; x < 16; x++)
+				TS_ASSERT_EQUALS(dst[y * kPitch + x], _src[y * kPitch + x + 3]);
+	}
+
+	void test_put_pixels_halfpel() {
+		fillSource();
+
+		byte dstX[kPitch * 16], dstY[kPitch * 16], dstXY[kPitch * 16];
+		Video::DSP::putPixels16X2(dstX, _src + 1, kPitch, 16);
+		Video::DSP::putPixels16Y2(dstY, _src + 1, kPitch, 16);
+		Video::DSP::putPixels16XY2(dstXY, _src + 1, kPitch, 16);
+
+		for (int y = 0; y < 16; y++) {
+			for (int x = 0; x < 16; x++) {
+				const byte *s = _src + 1 + y * kPitch + x;
+				TS_ASSERT_EQUALS(dstX[y * kPitch + x], (s[0] + s[1] + 1) >> 1);
+				TS_ASSERT_EQUALS(dstY[y * kPitch + x], (s[0] + s[kPitch] + 1) >> 1);
+				TS_ASSERT_EQUALS(dstXY[y * kPitch + x], (s[0] + s[1] + s[kPitch] + s[kPitch + 1] + 2) >> 2);
+			}
+		}
+	}
+
+	void test_fill_and_add() {
+		byte dst[kPitch * 16];
+		Video::DSP::fillBlock16(dst, 0xA5, kPitch);
+		for (int y = 0; y < 16; y++)
+			for (int x = 0; x < 16; x++)
+				TS_ASSERT_EQUALS(dst[y * kPitch + x], 0xA5);
+
+		int16 block[64];
+		for (int i = 0; i < 64; i++)
+			block[i] = i * 7 - 200;
+
+		Video::DSP::addBlock8(dst, block, kPitch);
+		for (int y = 0; y < 8; y++)
+			for (int x = 0; x < 8; x++)
+				TS_ASSERT_EQUALS(dst[y * kPitch + x], (byte)(0xA5 + block[y * 8 + x]));
+	}
+
+	void test_bink_idct_dc() {
+		int16 block[64];
+		for (int i = 0; i < 64; i++)
+			block[i] = 0;
+		block[0] = 1000;
+
+		byte dst[kPitch * 8];
+		Video::DSP::binkIDCTPut(dst, block, kPitch);
+		for (int y = 0; y < 8; y++)
+			for (int x = 0; x < 8; x++)
+				TS_ASSERT_EQUALS(dst[y * kPitch + x], (1000 + 0x7F) >> 8);
+	}
+
+	void test_bink_idct_put_add() {
+		int16 coeffs[64], block[64];
+		for (int i = 0; i < 64; i++)
+			coeffs[i] = block[i] = (i % 5) * 37 - (i % 3) * 41;
+
+		byte put[kPitch * 8], add[kPitch * 8];
+		for (int i = 0; i < kPitch * 8; i++)
+			add[i] = i & 0xFF;
+
+		Video::DSP::binkIDCTPut(put, coeffs, kPitch);
+		Video::DSP::binkIDCT(coeffs);
+		Video::DSP::binkIDCTAdd(add, block, kPitch);
+
+		for (int y = 0; y < 8; y++) {
+			for (int x = 0; x < 8; x++) {
+				TS_ASSERT_EQUALS(put[y * kPitch + x], (byte)coeffs[y * 8 + x]);
+				TS_ASSERT_EQUALS(add[y * kPitch + x], (byte)((y * kPitch + x) + coeffs[y * 8 + x]));
+			}
+		}
+	}
+
+	void test_float_idct() {
+		float coeffs[64], result[64];
+		for (int i = 0; i < 64; i++)
+			coeffs[i] = 0.0f;
+
+		// Sparse rows take the DC-only shortcut, the last one the full path
+		coeffs[0] = 80.0f;
+		coeffs[8] = -24.0f;
+		coeffs[57] = 12.0f;
+
+		Video::DSP::idctFloat8x8(coeffs, result);
+
+		for (int y = 0; y < 8; y++) {
+			for (int x = 0; x < 8; x++) {
+				double ref = 0.0;
+				for (int v = 0; v < 8; v++) {
+					for (int u = 0; u < 8; u++) {
+						const double cu = (u == 0) ? sqrt(0.5) : 1.0;
+						const double cv = (v == 0) ? sqrt(0.5) : 1.0;
+						ref += 0.25 * cu * cv * coeffs[v * 8 + u] *
+						       cos((2 * x + 1) * u * M_PI / 16.0) *
+						       cos((2 * y + 1) * v * M_PI / 16.0);
+					}
+				}
+
+				TS_ASSERT_DELTA(result[y * 8 + x], ref, 0.001);
+			}
+		}
+	}
+};
@@ -0,0 +1,69 @@
+#include <cxxtest/TestSuite.h>
+
+#include "video/frame_pool.h"
+#include "graphics/surface.h"
+
+class FramePoolTestSuite : public CxxTest::TestSuite {
+	public:
+	void test_reuse() {
+		Video::FramePool pool;
+		Graphics::PixelFormat format(2, 5, 6, 5, 0, 11, 5, 0, 0);
+
+		Graphics::Surface *a = pool.acquire(33, 10, format);
+		TS_ASSERT_EQUALS(a->w, 33);
+		TS_ASSERT_EQUALS(a->h, 10);
+		TS_ASSERT(a->format == format);
+		TS_ASSERT_EQUALS(a->pitch % Video::FramePool::kPitchAlignment, 0u);
+		TS_ASSERT(a->pitch >= 33 * 2);
+
+		// Steady state: a released surface is handed out again
+		for (int i = 0; i < 10; i++) {
+			pool.release(a);
+			Graphics::Surface *b = pool.acquire(33, 10, format);
+			TS_ASSERT_EQUALS(a, b);
+			a = b;
+		}
+
+		TS_ASSERT_EQUALS(pool.getAllocationCount(), 1u);
+		pool.release(a);
+	}
+
+	void test_mismatch() {
+		Video::FramePool pool;
+		Graphics::PixelFormat format16(2, 5, 6, 5, 0, 11, 5, 0, 0);
+		Graphics::PixelFormat format32(4, 8, 8, 8, 8, 24, 16, 8, 0);
+
+		Graphics::Surface *a = pool.acquire(16, 16, format16);
+		pool.release(a);
+
+		Graphics::Surface *b = pool.acquire(16, 16, format32);
+		Graphics::Surface *c = pool.acquire(16, 8, format16);
+		TS_ASSERT_EQUALS(pool.getAllocationCount(), 3u);
+		TS_ASSERT(b->format == format32);
+		TS_ASSERT_EQUALS(c->h, 8);
+
+		pool.release(b);
+		pool.release(c);
+	}
+
+	void test_max_free() {
+		Video::FramePool pool(2);
+		Graphics::PixelFormat format = Graphics::PixelFormat::createFormatCLUT8();
+
+		Graphics::Surface *surfaces[3];
+		for (int i = 0; i < 3; i++)
+			surfaces[i] = pool.acquire(8, 8, format);
+
+		for (int i = 0; i < 3; i++)
+			pool.release(surfaces[i]);
+
+		// Only two surfaces were kept, so the third acquire allocates
+		for (int i = 0; i < 3; i++)
+			surfaces[i] = pool.acquire(8, 8, format);
+
+		TS_ASSERT_EQUALS(pool.getAllocationCount(), 4u);
+
+		for (int i = 0; i < 3; i++)
+			pool.release(surfaces[i]);
+	}
+};
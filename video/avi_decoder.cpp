@@ -358,6 +358,9 @@ void AVIDecoder::close() {
 	_movieListEnd = 0;
 
 	_indexEntries.clear();
+	_frameIndex.clear();
+	_keyFrames.clear();
+	_paletteEntries.clear();
 	memset(&_header, 0, sizeof(_header));
 }
 
@@ -485,55 +488,45 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 	// Reset any palette, if necessary
 	videoTrack->useInitialPalette();
 
-	int lastKeyFrame = -1;
-	int frameIndex = -1;
-	int lastRecord = -1;
-	uint curFrame = 0;
+	// Build the frame index on the first seek
+	if (_frameIndex.empty())
+		buildFrameIndex(videoIndex);
 
-	// Go through and figure out where we should be
-	// If there's a palette, we need to find the palette too
-	for (uint32 i = 0; i < _indexEntries.size(); i++) {
-		const OldIndex &index = _indexEntries[i];
+	if (frame >= _frameIndex.size()) // This shouldn't happen.
+		return false;
 
-		if (index.id == ID_REC) {
-			// Keep track of any records we find
-			lastRecord = i;
-		} else {
-			if (getStreamIndex(index.id) != videoIndex)
-				continue;
+	int frameIndex = _frameIndex[frame].indexEntry;
+	int lastRecord = _frameIndex[frame].lastRecord;
 
-			uint16 streamType = getStreamType(index.id);
+	// Find the last keyframe at or before the target frame
+	uint32 keyFrame = 0;
+	for (uint32 lo = 0, hi = _keyFrames.size(); lo < hi; ) {
+		uint32 mid = (lo + hi) / 2;
 
-			if (streamType == kStreamTypePaletteChange) {
-				// We need to handle any palette change we see since there's no
-				// flag to tell if this is a "key" palette.
-				// Decode the palette
-				_fileStream->seek(_indexEntries[i].offset + 8);
-				Common::SeekableReadStream *chunk = 0;
+		if (_keyFrames[mid] <= frame) {
+			keyFrame = _keyFrames[mid];
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
 
-				if (_indexEntries[i].size != 0)
-					chunk = _fileStream->readStream(_indexEntries[i].size);
+	int lastKeyFrame = _frameIndex[keyFrame].indexEntry;
 
-				videoTrack->loadPaletteFromChunk(chunk);
-			} else {
-				// Check to see if this is a keyframe
-				// The first frame has to be a keyframe
-				if ((_indexEntries[i].flags & AVIIF_INDEX) || curFrame == 0)
-					lastKeyFrame = i;
+	// We need to handle any palette change we see since there's no
+	// flag to tell if this is a "key" palette.
+	for (uint32 i = 0; i < _paletteEntries.size() && (int)_paletteEntries[i] < frameIndex; i++) {
+		const OldIndex &index = _indexEntries[_paletteEntries[i]];
 
-				// Did we find the target frame?
-				if (frame == curFrame) {
-					frameIndex = i;
-					break;
-				}
+		// Decode the palette
+		_fileStream->seek(index.offset + 8);
+		Common::SeekableReadStream *chunk = 0;
 
-				curFrame++;
-			}
-		}
-	}
+		if (index.size != 0)
+			chunk = _fileStream->readStream(index.size);
 
-	if (frameIndex < 0) // This shouldn't happen.
-		return false;
+		videoTrack->loadPaletteFromChunk(chunk);
+	}
 
 	// Update all the audio tracks
 	uint audioIndex = 0;
@@ -624,6 +617,34 @@ bool AVIDecoder::seekIntern(const Audio::Timestamp &time) {
 	return true;
 }
 
+void AVIDecoder::buildFrameIndex(int videoIndex) {
+	int lastRecord = -1;
+
+	for (uint32 i = 0; i < _indexEntries.size(); i++) {
+		const OldIndex &index = _indexEntries[i];
+
+		if (index.id == ID_REC) {
+			// Keep track of any records we find
+			lastRecord = i;
+		} else if (getStreamIndex(index.id) == videoIndex) {
+			if (getStreamType(index.id) == kStreamTypePaletteChange) {
+				_paletteEntries.push_back(i);
+			} else {
+				// The first frame has to be a keyframe
+				if ((index.flags & AVIIF_INDEX) || _frameIndex.empty())
+					_keyFrames.push_back(_frameIndex.size());
+
+				FrameIndexEntry entry;
+				entry.indexEntry = i;
+				entry.lastRecord = lastRecord;
+				_frameIndex.push_back(entry);
+			}
+		}
+	}
+
+	debug(1, "AVI frame index: %d frames, %d keyframes, %d palette changes", _frameIndex.size(), _keyFrames.size(), _paletteEntries.size());
+}
+
 byte AVIDecoder::getStreamIndex(uint32 tag) const {
 	char string[3];
 	WRITE_BE_UINT16(string, tag >> 16);
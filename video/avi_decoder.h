@@ -239,6 +239,18 @@ protected:
 	void readOldIndex(uint32 size);
 	Common::Array<OldIndex> _indexEntries;
 
+	/** Where a video frame and its enclosing record live in the index. */
+	struct FrameIndexEntry {
+		int indexEntry; ///< Position of the frame in _indexEntries
+		int lastRecord; ///< Position of the last 'rec ' list before it, or -1
+	};
+
+	/** Build the video frame lookup tables from the old index for seeking. */
+	void buildFrameIndex(int videoIndex);
+	Common::Array<FrameIndexEntry> _frameIndex; ///< Entry for each video frame
+	Common::Array<uint32> _keyFrames;           ///< Keyframe numbers, ascending
+	Common::Array<uint32> _paletteEntries;      ///< Palette changes in _indexEntries
+
 	Common::SeekableReadStream *_fileStream;
 	bool _decodedHeader;
 	bool _foundMovieList;
@@ -0,0 +1,163 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+// FIXME: Avoid using printf
+#define FORBIDDEN_SYMBOL_EXCEPTION_printf
+#define FORBIDDEN_SYMBOL_EXCEPTION_time_h
+
+#include "common/algorithm.h"
+#include "common/array.h"
+#include "common/fs.h"
+#include "common/system.h"
+
+#include "video/benchmark.h"
+#include "video/avi_decoder.h"
+#include "video/bink_decoder.h"
+#include "video/dxa_decoder.h"
+#include "video/flic_decoder.h"
+#include "video/psx_decoder.h"
+#include "video/qt_decoder.h"
+#include "video/smk_decoder.h"
+#include "video/theora_decoder.h"
+
+// Currently, only GOB and SCI32 games play IMDs and VMDs, see video/coktel_decoder.h
+#if defined(ENABLE_GOB) || defined(ENABLE_SCI32) || defined(DYNAMIC_MODULES)
+#include "video/coktel_decoder.h"
+#endif
+
+#if defined(POSIX)
+#include <sys/resource.h>
+#endif
+
+namespace Video {
+
+/** Create a video decoder fitting the extension of the file name. */
+static VideoDecoder *createVideoDecoder(Common::String filename) {
+	filename.toLowercase();
+
+	if (filename.hasSuffix(".avi"))
+		return new AVIDecoder();
+#ifdef USE_BINK
+	if (filename.hasSuffix(".bik"))
+		return new BinkDecoder();
+#endif
+	if (filename.hasSuffix(".dxa"))
+		return new DXADecoder();
+	if (filename.hasSuffix(".fli") || filename.hasSuffix(".flc"))
+		return new FlicDecoder();
+	if (filename.hasSuffix(".mov"))
+		return new QuickTimeDecoder();
+	if (filename.hasSuffix(".smk"))
+		return new SmackerDecoder();
+	if (filename.hasSuffix(".str"))
+		return new PSXStreamDecoder(PSXStreamDecoder::kCD2x);
+#ifdef USE_THEORADEC
+	if (filename.hasSuffix(".ogg") || filename.hasSuffix(".ogv"))
+		return new TheoraDecoder();
+#endif
+#if defined(ENABLE_GOB) || defined(ENABLE_SCI32) || defined(DYNAMIC_MODULES)
+	if (filename.hasSuffix(".vmd"))
+		return new AdvancedVMDDecoder();
+#endif
+
+	return 0;
+}
+
+/** Return the peak resident memory of the process in KB, or 0 if unknown. */
+static uint32 getPeakMemory() {
+#if defined(POSIX)
+	rusage usage;
+	if (getrusage(RUSAGE_SELF, &usage))
+		return 0;
+
+#if defined(MACOSX)
+	// Given in bytes instead of KB
+	return usage.ru_maxrss / 1024;
+#else
+	return usage.ru_maxrss;
+#endif
+#else
+	return 0;
+#endif
+}
+
+Common::Error benchmarkVideo(const Common::String &filename, int bpp) {
+	const uint32 startMemory = getPeakMemory();
+
+	VideoDecoder *video = createVideoDecoder(filename);
+	if (!video)
+		return Common::Error(Common::kUnknownError, "No video decoder for '" + filename + "'");
+
+	if (bpp == 16)
+		video->setDefaultHighColorFormat(Graphics::PixelFormat(2, 5, 6, 5, 0, 11, 5, 0, 0));
+	else if (bpp == 32)
+		video->setDefaultHighColorFormat(Graphics::PixelFormat(4, 8, 8, 8, 8, 24, 16, 8, 0));
+
+	Common::SeekableReadStream *stream = Common::FSNode(filename).createReadStream();
+	if (!stream || !video->loadStream(stream)) {
+		delete video;
+		return Common::Error(Common::kReadingFailed, filename);
+	}
+
+	Common::Array<uint32> frameTimes;
+	const uint32 startTime = g_system->getMillis();
+
+	// Without start(), the audio tracks are not played and the video
+	// tracks are not synced to the clock, so the frames come as fast as
+	// they can be decoded
+	while (!video->endOfVideo()) {
+		const int curFrame = video->getCurFrame();
+		const uint32 frameStart = g_system->getMillis();
+
+		video->decodeNextFrame();
+		frameTimes.push_back(g_system->getMillis() - frameStart);
+
+		if (video->getCurFrame() == curFrame)
+			break;
+	}
+
+	const uint32 totalTime = g_system->getMillis() - startTime;
+
+	printf("Video:    %s (%dx%d, %d bpp)\n", filename.c_str(), video->getWidth(), video->getHeight(),
+			video->getPixelFormat().bytesPerPixel * 8);
+	printf("Frames:   %d in %d ms (%.2f fps)\n", frameTimes.size(), totalTime,
+			totalTime ? frameTimes.size() * 1000.0 / totalTime : 0.0);
+
+	if (!frameTimes.empty()) {
+		Common::sort(frameTimes.begin(), frameTimes.end());
+
+		const uint last = frameTimes.size() - 1;
+		printf("Per frame (ms): median %d, 90%% %d, 99%% %d, max %d\n",
+				frameTimes[last / 2], frameTimes[last * 90 / 100], frameTimes[last * 99 / 100], frameTimes[last]);
+	}
+
+	// The peak is process wide, so it only grows during the benchmark if
+	// decoding needed more memory than the startup did
+	const uint32 peakMemory = getPeakMemory();
+	if (peakMemory)
+		printf("Peak memory: %d KB (%d KB before loading the video)\n", peakMemory, startMemory);
+
+	delete video;
+	return Common::kNoError;
+}
+
+} // End of namespace Video
@@ -0,0 +1,45 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+#ifndef VIDEO_BENCHMARK_H
+#define VIDEO_BENCHMARK_H
+
+#include "common/error.h"
+#include "common/str.h"
+
+namespace Video {
+
+/**
+ * Decode every frame of a video as fast as possible, and print the
+ * overall frame rate, the distribution of the single frame times and,
+ * where the system reports it, the peak memory use.
+ * The decoder is picked by the extension of the file name.
+ *
+ * @param filename	the video file to decode
+ * @param bpp		16 or 32 to select the output format of true colour
+ *					decoders, 0 for their default
+ */
+Common::Error benchmarkVideo(const Common::String &filename, int bpp);
+
+} // End of namespace Video
+
+#endif
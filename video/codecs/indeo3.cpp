@@ -56,6 +56,7 @@ Indeo3Decoder::Indeo3Decoder(uint16 width, uint16 height) : _ModPred(0), _correc
 Indeo3Decoder::~Indeo3Decoder() {
 	_surface->free();
 	delete _surface;
+	_scaleSurface.free();
 
 	delete[] _iv_frame[0].the_buf;
 	delete[] _ModPred;
@@ -228,12 +229,12 @@ const Graphics::Surface *Indeo3Decoder::decodeImage(Common::SeekableReadStream *
 
 	uint32 dataSize = stream->size() - hPos;
 
-	byte *inData = new byte[dataSize];
+	// The work buffers are kept between frames and only ever grow
+	_inData.resize(dataSize);
+	byte *inData = _inData.begin();
 
-	if (stream->read(inData, dataSize) != dataSize) {
-		delete[] inData;
+	if (stream->read(inData, dataSize) != dataSize)
 		return 0;
-	}
 
 	byte *hdr_pos = inData;
 	byte *buf_pos;
@@ -259,16 +260,16 @@ const Graphics::Surface *Indeo3Decoder::decodeImage(Common::SeekableReadStream *
 	decodeChunk(_cur_frame->Ubuf, _ref_frame->Ubuf, chromaWidth, chromaHeight,
 			buf_pos + offs * 2, flags2, hdr_pos, buf_pos, MIN<int>(chromaWidth, 40));
 
-	delete[] inData;
-
 	const byte *srcY = _cur_frame->Ybuf;
 	const byte *srcU = _cur_frame->Ubuf;
 	const byte *srcV = _cur_frame->Vbuf;
 
 	// Create buffers for U/V with an extra row/column copied from the second-to-last
 	// row/column.
-	byte *tempU = new byte[(chromaWidth + 1) * (chromaHeight + 1)];
-	byte *tempV = new byte[(chromaWidth + 1) * (chromaHeight + 1)];
+	_tempU.resize((chromaWidth + 1) * (chromaHeight + 1));
+	_tempV.resize((chromaWidth + 1) * (chromaHeight + 1));
+	byte *tempU = _tempU.begin();
+	byte *tempV = _tempV.begin();
 
 	for (uint i = 0; i < chromaHeight; i++) {
 		memcpy(tempU + (chromaWidth + 1) * i, srcU + chromaWidth * i, chromaWidth);
@@ -292,8 +293,10 @@ const Graphics::Surface *Indeo3Decoder::decodeImage(Common::SeekableReadStream *
 				fWidth, fHeight, fWidth, chromaWidth + 1);
 	} else {
 		// Need to upscale, so decode to a temp surface first
-		Graphics::Surface tempSurface;
-		tempSurface.create(fWidth, fHeight, _surface->format);
+		Graphics::Surface &tempSurface = _scaleSurface;
+
+		if (tempSurface.w != fWidth || tempSurface.h != fHeight)
+			tempSurface.create(fWidth, fHeight, _surface->format);
 
 		YUVToRGBMan.convert410(&tempSurface, Graphics::YUVToRGBManager::kScaleITU, srcY, tempU, tempV,
 				fWidth, fHeight, fWidth, chromaWidth + 1);
@@ -309,13 +312,8 @@ const Graphics::Surface *Indeo3Decoder::decodeImage(Common::SeekableReadStream *
 					*((uint32 *)_surface->getBasePtr(x, y)) = *((uint32 *)tempSurface.getBasePtr(x / scaleWidth, y / scaleHeight));
  			}
 		}
-
-		tempSurface.free();
 	}
 
-	delete[] tempU;
-	delete[] tempV;
-
 	return _surface;
 }
 
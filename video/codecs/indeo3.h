@@ -32,6 +32,8 @@
 #ifndef VIDEO_CODECS_INDEO3_H
 #define VIDEO_CODECS_INDEO3_H
 
+#include "common/array.h"
+
 #include "video/codecs/codec.h"
 
 namespace Video {
@@ -55,6 +57,10 @@ public:
 
 private:
 	Graphics::Surface *_surface;
+	Graphics::Surface _scaleSurface;
+
+	Common::Array<byte> _inData;
+	Common::Array<byte> _tempU, _tempV;
 
 	Graphics::PixelFormat _pixelFormat;
 
@@ -22,6 +22,7 @@
 
 #include "common/system.h"
 #include "common/textconsole.h"
+#include "graphics/conversion.h"
 #include "graphics/surface.h"
 #include "graphics/decoders/jpeg.h"
 
@@ -53,12 +54,21 @@ const Graphics::Surface *JPEGDecoder::decodeImage(Common::SeekableReadStream *st
 		return 0;
 	}
 
-	if (_surface) {
-		_surface->free();
-		delete _surface;
+	const Graphics::Surface *frame = jpeg.getSurface();
+
+	// Convert into the same surface every frame, unless the size changes
+	if (!_surface || _surface->w != frame->w || _surface->h != frame->h) {
+		if (_surface) {
+			_surface->free();
+			delete _surface;
+		}
+
+		_surface = new Graphics::Surface();
+		_surface->create(frame->w, frame->h, _pixelFormat);
 	}
 
-	_surface = jpeg.getSurface()->convertTo(_pixelFormat);
+	Graphics::crossBlit((byte *)_surface->getPixels(), (const byte *)frame->getPixels(), _surface->pitch, frame->pitch,
+			frame->w, frame->h, _pixelFormat, frame->format);
 
 	return _surface;
 }
@@ -26,6 +26,7 @@
 #include "video/codecs/svq1.h"
 #include "video/codecs/svq1_cb.h"
 #include "video/codecs/svq1_vlc.h"
+#include "video/dsp.h"
 
 #include "common/stream.h"
 #include "common/bitstream.h"
@@ -51,9 +52,11 @@ SVQ1Decoder::SVQ1Decoder(uint16 width, uint16 height) {
 	_frameWidth = _frameHeight = 0;
 	_surface = 0;
 
-	_last[0] = 0;
-	_last[1] = 0;
-	_last[2] = 0;
+	_last[0] = _current[0] = 0;
+	_last[1] = _current[1] = 0;
+	_last[2] = _current[2] = 0;
+	_planeWidth = _planeHeight = 0;
+	_pmv = 0;
 
 	// Setup Variable Length Code Tables
 	_blockType = new Common::Huffman(0, 4, s_svq1BlockTypeCodes, s_svq1BlockTypeLengths);
@@ -74,9 +77,7 @@ SVQ1Decoder::~SVQ1Decoder() {
 		delete _surface;
 	}
 
-	delete[] _last[0];
-	delete[] _last[1];
-	delete[] _last[2];
+	freePlanes();
 
 	delete _blockType;
 	delete _intraMean;
@@ -186,7 +187,26 @@ const Graphics::Surface *SVQ1Decoder::decodeImage(Common::SeekableReadStream *st
 	uint uvHeight = ALIGN(yHeight / 4, 16);
 	uint uvPitch = uvWidth + 4; // we need at least one extra column and pitch must be divisible by 4
 
-	byte *current[3];
+	// The planes are only reallocated when the frame size changes, the
+	// current and last planes are swapped after every frame.
+	if (yWidth != _planeWidth || yHeight != _planeHeight) {
+		freePlanes();
+
+		for (int i = 0; i < 2; i++) {
+			byte **planes = (i == 0) ? _current : _last;
+			planes[0] = new byte[yWidth * yHeight];
+
+			// Add an extra row here. See below for more information.
+			planes[1] = new byte[uvPitch * (uvHeight + 1)];
+			planes[2] = new byte[uvPitch * (uvHeight + 1)];
+		}
+
+		_pmv = new Common::Point[(yWidth / 8) + 3];
+		_planeWidth = yWidth;
+		_planeHeight = yHeight;
+	}
+
+	byte **current = _current;
 
 	// Decode Y, U and V component planes
 	for (int i = 0; i < 3; i++) {
@@ -195,14 +215,10 @@ const Graphics::Surface *SVQ1Decoder::decodeImage(Common::SeekableReadStream *st
 			width = yWidth;
 			height = yHeight;
 			pitch = width;
-			current[i] = new byte[width * height];
 		} else {
 			width = uvWidth;
 			height = uvHeight;
 			pitch = uvPitch;
-
-			// Add an extra row here. See below for more information.
-			current[i] = new byte[pitch * (height + 1)];
 		}
 
 		if (frameType == 0) { // I Frame
@@ -221,7 +237,9 @@ const Graphics::Surface *SVQ1Decoder::decodeImage(Common::SeekableReadStream *st
 			// Delta frame (P or B)
 
 			// Prediction Motion Vector
-			Common::Point *pmv = new Common::Point[(width / 8) + 3];
+			Common::Point *pmv = _pmv;
+			for (uint j = 0; j < (width / 8) + 3; j++)
+				pmv[j] = Common::Point();
 
 			byte *previous = 0;
 			if (frameType == 2) { // B Frame
@@ -244,8 +262,6 @@ const Graphics::Surface *SVQ1Decoder::decodeImage(Common::SeekableReadStream *st
 
 				currentP += 16 * pitch;
 			}
-
-			delete[] pmv;
 		}
 	}
 
@@ -273,13 +289,23 @@ const Graphics::Surface *SVQ1Decoder::decodeImage(Common::SeekableReadStream *st
 	// Finally, actually do the conversion ;)
 	YUVToRGBMan.convert410(_surface, Graphics::YUVToRGBManager::kScaleFull, current[0], current[1], current[2], yWidth, yHeight, yWidth, uvPitch);
 
-	// Store the current surfaces for later and free the old ones
+	// Keep the current planes for the next frame to predict from
+	for (int i = 0; i < 3; i++)
+		SWAP(_last[i], _current[i]);
+
+	return _surface;
+}
+
+void SVQ1Decoder::freePlanes() {
 	for (int i = 0; i < 3; i++) {
+		delete[] _current[i];
 		delete[] _last[i];
-		_last[i] = current[i];
+		_current[i] = _last[i] = 0;
 	}
 
-	return _surface;
+	delete[] _pmv;
+	_pmv = 0;
+	_planeWidth = _planeHeight = 0;
 }
 
 bool SVQ1Decoder::svq1DecodeBlockIntra(Common::BitStream *s, byte *pixels, int pitch) {
@@ -517,98 +543,7 @@ bool SVQ1Decoder::svq1DecodeMotionVector(Common::BitStream *s, Common::Point *mv
 }
 
 void SVQ1Decoder::svq1SkipBlock(byte *current, byte *previous, int pitch, int x, int y) {
-	const byte *src = &previous[x + y * pitch];
-	byte *dst = current;
-
-	for (int i = 0; i < 16; i++) {
-		memcpy(dst, src, 16);
-		src += pitch;
-		dst += pitch;
-	}
-}
-
-void SVQ1Decoder::putPixels8C(byte *block, const byte *pixels, int lineSize, int h) {
-	for (int i = 0; i < h; i++) {
-		*((uint32 *)block) = READ_UINT32(pixels);
-		*((uint32 *)(block + 4)) = READ_UINT32(pixels + 4);
-		pixels += lineSize;
-		block += lineSize;
-	}
-}
-
-static inline uint32 rndAvg32(uint32 a, uint32 b) {
-	return (a | b) - (((a ^ b) & ~0x01010101) >> 1);
-}
-
-void SVQ1Decoder::putPixels8L2(byte *dst, const byte *src1, const byte *src2,
-		int dstStride, int srcStride1, int srcStride2, int h) {
-	for (int i = 0; i < h; i++) {
-		uint32 a = READ_UINT32(&src1[srcStride1 * i]);
-		uint32 b = READ_UINT32(&src2[srcStride2 * i]);
-		*((uint32 *)&dst[dstStride * i]) = rndAvg32(a, b);
-		a = READ_UINT32(&src1[srcStride1 * i + 4]);
-		b = READ_UINT32(&src2[srcStride2 * i + 4]);
-		*((uint32 *)&dst[dstStride * i + 4]) = rndAvg32(a, b);
-	}
-}
-
-void SVQ1Decoder::putPixels8X2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8L2(block, pixels, pixels + 1, lineSize, lineSize, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels8Y2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8L2(block, pixels, pixels + lineSize, lineSize, lineSize, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels8XY2C(byte *block, const byte *pixels, int lineSize, int h) {
-	for (int j = 0; j < 2; j++) {
-		uint32 a = READ_UINT32(pixels);
-		uint32 b = READ_UINT32(pixels + 1);
-		uint32 l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
-		uint32 h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-
-		pixels += lineSize;
-
-		for (int i = 0; i < h; i += 2) {
-			a = READ_UINT32(pixels);
-			b = READ_UINT32(pixels + 1);
-			uint32 l1 = (a & 0x03030303UL) + (b & 0x03030303UL);
-			uint32 h1 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-			*((uint32 *)block) = h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL);
-			pixels += lineSize;
-			block += lineSize;
-			a = READ_UINT32(pixels);
-			b = READ_UINT32(pixels + 1);
-			l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
-			h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
-			*((uint32 *)block) = h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL);
-			pixels += lineSize;
-			block += lineSize;
-		}
-
-		pixels += 4 - lineSize * (h + 1);
-		block += 4 - lineSize * h;
-	}
-}
-
-void SVQ1Decoder::putPixels16C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8C(block, pixels, lineSize, h);
-	putPixels8C(block + 8, pixels + 8, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels16X2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8X2C(block, pixels, lineSize, h);
-	putPixels8X2C(block + 8, pixels + 8, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels16Y2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8Y2C(block, pixels, lineSize, h);
-	putPixels8Y2C(block + 8, pixels + 8, lineSize, h);
-}
-
-void SVQ1Decoder::putPixels16XY2C(byte *block, const byte *pixels, int lineSize, int h) {
-	putPixels8XY2C(block, pixels, lineSize, h);
-	putPixels8XY2C(block + 8, pixels + 8, lineSize, h);
+	DSP::putPixels16(current, &previous[x + y * pitch], pitch, 16);
 }
 
 bool SVQ1Decoder::svq1MotionInterBlock(Common::BitStream *ss, byte *current, byte *previous, int pitch,
@@ -646,16 +581,16 @@ bool SVQ1Decoder::svq1MotionInterBlock(Common::BitStream *ss, byte *current, byt
 	// for 16x16 blocks
 	switch(((mv.y & 1) << 1) + (mv.x & 1)) {
 	case 0:
-		putPixels16C(dst, src, pitch, 16);
+		DSP::putPixels16(dst, src, pitch, 16);
 		break;
 	case 1:
-		putPixels16X2C(dst, src, pitch, 16);
+		DSP::putPixels16X2(dst, src, pitch, 16);
 		break;
 	case 2:
-		putPixels16Y2C(dst, src, pitch, 16);
+		DSP::putPixels16Y2(dst, src, pitch, 16);
 		break;
 	case 3:
-		putPixels16XY2C(dst, src, pitch, 16);
+		DSP::putPixels16XY2(dst, src, pitch, 16);
 		break;
 	}
 
@@ -726,16 +661,16 @@ bool SVQ1Decoder::svq1MotionInter4vBlock(Common::BitStream *ss, byte *current, b
 		// for 8x8 blocks
 		switch(((mvy & 1) << 1) + (mvx & 1)) {
 		case 0:
-			putPixels8C(dst, src, pitch, 8);
+			DSP::putPixels8(dst, src, pitch, 8);
 			break;
 		case 1:
-			putPixels8X2C(dst, src, pitch, 8);
+			DSP::putPixels8X2(dst, src, pitch, 8);
 			break;
 		case 2:
-			putPixels8Y2C(dst, src, pitch, 8);
+			DSP::putPixels8Y2(dst, src, pitch, 8);
 			break;
 		case 3:
-			putPixels8XY2C(dst, src, pitch, 8);
+			DSP::putPixels8XY2(dst, src, pitch, 8);
 			break;
 		}
 
@@ -53,6 +53,11 @@ private:
 	uint16 _frameWidth, _frameHeight;
 
 	byte *_last[3];
+	byte *_current[3];
+	uint _planeWidth, _planeHeight;
+	Common::Point *_pmv;
+
+	void freePlanes();
 
 	Common::Huffman *_blockType;
 	Common::Huffman *_intraMultistage[6];
@@ -71,16 +76,6 @@ private:
 			Common::Point *motion, int x, int y);
 	bool svq1DecodeDeltaBlock(Common::BitStream *ss, byte *current, byte *previous, int pitch,
 			Common::Point *motion, int x, int y);
-
-	void putPixels8C(byte *block, const byte *pixels, int lineSize, int h);
-	void putPixels8L2(byte *dst, const byte *src1, const byte *src2, int dstStride, int srcStride1, int srcStride2, int h);
-	void putPixels8X2C(byte *block, const byte *pixels, int lineSize, int h);
-	void putPixels8Y2C(byte *block, const byte *pixels, int lineSize, int h);
-	void putPixels8XY2C(byte *block, const byte *pixels, int lineSize, int h);
-	void putPixels16C(byte *block, const byte *pixels, int lineSize, int h);
-	void putPixels16X2C(byte *block, const byte *pixels, int lineSize, int h);
-	void putPixels16Y2C(byte *block, const byte *pixels, int lineSize, int h);
-	void putPixels16XY2C(byte *block, const byte *pixels, int lineSize, int h);
 };
 
 } // End of namespace Video
@@ -100,6 +100,7 @@ TrueMotion1Decoder::TrueMotion1Decoder(uint16 width, uint16 height) {
 	_vertPred = new uint32[_width];
 
 	_buf = _mbChangeBits = _indexStream = 0;
+	_bufSize = 0;
 	_lastDeltaset = _lastVectable = -1;
 }
 
@@ -107,6 +108,7 @@ TrueMotion1Decoder::~TrueMotion1Decoder() {
 	_surface->free();
 	delete _surface;
 	delete[] _vertPred;
+	delete[] _buf;
 }
 
 void TrueMotion1Decoder::selectDeltaTables(int deltaTableIndex) {
@@ -164,7 +166,13 @@ void TrueMotion1Decoder::genVectorTable16(const byte *selVectorTable) {
 }
 
 void TrueMotion1Decoder::decodeHeader(Common::SeekableReadStream *stream) {
-	_buf = new byte[stream->size()];
+	// Keep the frame buffer around, frames rarely grow once playing
+	if ((uint32)stream->size() > _bufSize) {
+		delete[] _buf;
+		_bufSize = stream->size();
+		_buf = new byte[_bufSize];
+	}
+
 	stream->read(_buf, stream->size());
 
 	byte headerBuffer[128];  // logical maximum size of the header
@@ -400,20 +408,15 @@ void TrueMotion1Decoder::decode16() {
 const Graphics::Surface *TrueMotion1Decoder::decodeImage(Common::SeekableReadStream *stream) {
 	decodeHeader(stream);
 
-	if (compressionTypes[_header.compression].algorithm == ALGO_NOP) {
-		delete[] _buf;
+	if (compressionTypes[_header.compression].algorithm == ALGO_NOP)
 		return 0;
-	}
 
 	if (compressionTypes[_header.compression].algorithm == ALGO_RGB24H) {
 		warning("Unhandled TrueMotion1 24bpp frame");
-		delete[] _buf;
 		return 0;
 	} else
 		decode16();
 
-	delete[] _buf;
-
 	return _surface;
 }
 
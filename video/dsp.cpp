@@ -0,0 +1,294 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#include "video/dsp.h"
+
+#include "common/endian.h"
+
+namespace Video {
+
+namespace DSP {
+
+void putPixels8(byte *block, const byte *pixels, int pitch, int h) {
+	for (int i = 0; i < h; i++) {
+		WRITE_UINT32(block,     READ_UINT32(pixels));
+		WRITE_UINT32(block + 4, READ_UINT32(pixels + 4));
+		pixels += pitch;
+		block  += pitch;
+	}
+}
+
+void putPixels16(byte *block, const byte *pixels, int pitch, int h) {
+	putPixels8(block,     pixels,     pitch, h);
+	putPixels8(block + 8, pixels + 8, pitch, h);
+}
+
+/** Average four pixels packed in 32 bits each, rounding up. */
+static inline uint32 rndAvg32(uint32 a, uint32 b) {
+	return (a | b) - (((a ^ b) & ~0x01010101) >> 1);
+}
+
+static void putPixels8L2(byte *dst, const byte *src1, const byte *src2, int pitch, int h) {
+	for (int i = 0; i < h; i++) {
+		WRITE_UINT32(dst,     rndAvg32(READ_UINT32(src1),     READ_UINT32(src2)));
+		WRITE_UINT32(dst + 4, rndAvg32(READ_UINT32(src1 + 4), READ_UINT32(src2 + 4)));
+		dst  += pitch;
+		src1 += pitch;
+		src2 += pitch;
+	}
+}
+
+void putPixels8X2(byte *block, const byte *pixels, int pitch, int h) {
+	putPixels8L2(block, pixels, pixels + 1, pitch, h);
+}
+
+void putPixels8Y2(byte *block, const byte *pixels, int pitch, int h) {
+	putPixels8L2(block, pixels, pixels + pitch, pitch, h);
+}
+
+void putPixels8XY2(byte *block, const byte *pixels, int pitch, int h) {
+	// Split each byte into its two low and six high bits, so that four
+	// pixels can be summed at once without overflowing into each other
+	for (int j = 0; j < 2; j++) {
+		uint32 a = READ_UINT32(pixels);
+		uint32 b = READ_UINT32(pixels + 1);
+		uint32 l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
+		uint32 h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
+
+		pixels += pitch;
+
+		for (int i = 0; i < h; i += 2) {
+			a = READ_UINT32(pixels);
+			b = READ_UINT32(pixels + 1);
+			uint32 l1 = (a & 0x03030303UL) + (b & 0x03030303UL);
+			uint32 h1 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
+			WRITE_UINT32(block, h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL));
+			pixels += pitch;
+			block  += pitch;
+			a = READ_UINT32(pixels);
+			b = READ_UINT32(pixels + 1);
+			l0 = (a & 0x03030303UL) + (b & 0x03030303UL) + 0x02020202UL;
+			h0 = ((a & 0xFCFCFCFCUL) >> 2) + ((b & 0xFCFCFCFCUL) >> 2);
+			WRITE_UINT32(block, h0 + h1 + (((l0 + l1) >> 2) & 0x0F0F0F0FUL));
+			pixels += pitch;
+			block  += pitch;
+		}
+
+		pixels += 4 - pitch * (h + 1);
+		block  += 4 - pitch * h;
+	}
+}
+
+void putPixels16X2(byte *block, const byte *pixels, int pitch, int h) {
+	putPixels8X2(block,     pixels,     pitch, h);
+	putPixels8X2(block + 8, pixels + 8, pitch, h);
+}
+
+void putPixels16Y2(byte *block, const byte *pixels, int pitch, int h) {
+	putPixels8Y2(block,     pixels,     pitch, h);
+	putPixels8Y2(block + 8, pixels + 8, pitch, h);
+}
+
+void putPixels16XY2(byte *block, const byte *pixels, int pitch, int h) {
+	putPixels8XY2(block,     pixels,     pitch, h);
+	putPixels8XY2(block + 8, pixels + 8, pitch, h);
+}
+
+void fillBlock8(byte *block, byte value, int pitch) {
+	const uint32 v = value * 0x01010101U;
+
+	for (int i = 0; i < 8; i++, block += pitch) {
+		WRITE_UINT32(block,     v);
+		WRITE_UINT32(block + 4, v);
+	}
+}
+
+void fillBlock16(byte *block, byte value, int pitch) {
+	fillBlock8(block,                 value, pitch);
+	fillBlock8(block + 8,             value, pitch);
+	fillBlock8(block + 8 * pitch,     value, pitch);
+	fillBlock8(block + 8 * pitch + 8, value, pitch);
+}
+
+void addBlock8(byte *block, const int16 *src, int pitch) {
+	for (int i = 0; i < 8; i++, block += pitch, src += 8) {
+		block[0] += src[0];
+		block[1] += src[1];
+		block[2] += src[2];
+		block[3] += src[3];
+		block[4] += src[4];
+		block[5] += src[5];
+		block[6] += src[6];
+		block[7] += src[7];
+	}
+}
+
+#define A1  2896 /* (1/sqrt(2))<<12 */
+#define A2  2217
+#define A3  3784
+#define A4 -5352
+
+#define IDCT_TRANSFORM(dest,s0,s1,s2,s3,s4,s5,s6,s7,d0,d1,d2,d3,d4,d5,d6,d7,munge,src) {\
+    const int a0 = (src)[s0] + (src)[s4]; \
+    const int a1 = (src)[s0] - (src)[s4]; \
+    const int a2 = (src)[s2] + (src)[s6]; \
+    const int a3 = (A1*((src)[s2] - (src)[s6])) >> 11; \
+    const int a4 = (src)[s5] + (src)[s3]; \
+    const int a5 = (src)[s5] - (src)[s3]; \
+    const int a6 = (src)[s1] + (src)[s7]; \
+    const int a7 = (src)[s1] - (src)[s7]; \
+    const int b0 = a4 + a6; \
+    const int b1 = (A3*(a5 + a7)) >> 11; \
+    const int b2 = ((A4*a5) >> 11) - b0 + b1; \
+    const int b3 = (A1*(a6 - a4) >> 11) - b2; \
+    const int b4 = ((A2*a7) >> 11) + b3 - b1; \
+    (dest)[d0] = munge(a0+a2   +b0); \
+    (dest)[d1] = munge(a1+a3-a2+b2); \
+    (dest)[d2] = munge(a1-a3+a2+b3); \
+    (dest)[d3] = munge(a0-a2   -b4); \
+    (dest)[d4] = munge(a0-a2   +b4); \
+    (dest)[d5] = munge(a1-a3+a2-b3); \
+    (dest)[d6] = munge(a1+a3-a2-b2); \
+    (dest)[d7] = munge(a0+a2   -b0); \
+}
+/* end IDCT_TRANSFORM macro */
+
+#define MUNGE_NONE(x) (x)
+#define IDCT_COL(dest,src) IDCT_TRANSFORM(dest,0,8,16,24,32,40,48,56,0,8,16,24,32,40,48,56,MUNGE_NONE,src)
+
+#define MUNGE_ROW(x) (((x) + 0x7F)>>8)
+#define IDCT_ROW(dest,src) IDCT_TRANSFORM(dest,0,1,2,3,4,5,6,7,0,1,2,3,4,5,6,7,MUNGE_ROW,src)
+
+static inline void binkIDCTCol(int16 *dest, const int16 *src) {
+	if ((src[8] | src[16] | src[24] | src[32] | src[40] | src[48] | src[56]) == 0) {
+		dest[ 0] =
+		dest[ 8] =
+		dest[16] =
+		dest[24] =
+		dest[32] =
+		dest[40] =
+		dest[48] =
+		dest[56] = src[0];
+	} else {
+		IDCT_COL(dest, src);
+	}
+}
+
+void binkIDCT(int16 *block) {
+	int16 temp[64];
+
+	for (int i = 0; i < 8; i++)
+		binkIDCTCol(&temp[i], &block[i]);
+	for (int i = 0; i < 8; i++)
+		IDCT_ROW( (&block[8*i]), (&temp[8*i]) );
+}
+
+void binkIDCTPut(byte *block, const int16 *coeffs, int pitch) {
+	int16 temp[64];
+
+	for (int i = 0; i < 8; i++)
+		binkIDCTCol(&temp[i], &coeffs[i]);
+	for (int i = 0; i < 8; i++)
+		IDCT_ROW( (&block[i*pitch]), (&temp[8*i]) );
+}
+
+void binkIDCTAdd(byte *block, int16 *coeffs, int pitch) {
+	binkIDCT(coeffs);
+	addBlock8(block, coeffs, pitch);
+}
+
+#undef A1
+#undef A2
+#undef A3
+#undef A4
+#undef IDCT_TRANSFORM
+#undef MUNGE_NONE
+#undef IDCT_COL
+#undef MUNGE_ROW
+#undef IDCT_ROW
+
+// IDCT table built with :
+// _idct8x8[x][y] = cos(((2 * x + 1) * y) * (M_PI / 16.0)) * 0.5;
+// _idct8x8[x][y] /= sqrt(2.0) if y == 0
+static const double s_idct8x8[8][8] = {
+	{ 0.353553390593274,  0.490392640201615,  0.461939766255643,  0.415734806151273,  0.353553390593274,  0.277785116509801,  0.191341716182545,  0.097545161008064 },
+	{ 0.353553390593274,  0.415734806151273,  0.191341716182545, -0.097545161008064, -0.353553390593274, -0.490392640201615, -0.461939766255643, -0.277785116509801 },
+	{ 0.353553390593274,  0.277785116509801, -0.191341716182545, -0.490392640201615, -0.353553390593274,  0.097545161008064,  0.461939766255643,  0.415734806151273 },
+	{ 0.353553390593274,  0.097545161008064, -0.461939766255643, -0.277785116509801,  0.353553390593274,  0.415734806151273, -0.191341716182545, -0.490392640201615 },
+	{ 0.353553390593274, -0.097545161008064, -0.461939766255643,  0.277785116509801,  0.353553390593274, -0.415734806151273, -0.191341716182545,  0.490392640201615 },
+	{ 0.353553390593274, -0.277785116509801, -0.191341716182545,  0.490392640201615, -0.353553390593273, -0.097545161008064,  0.461939766255643, -0.415734806151273 },
+	{ 0.353553390593274, -0.415734806151273,  0.191341716182545,  0.097545161008064, -0.353553390593274,  0.490392640201615, -0.461939766255643,  0.277785116509801 },
+	{ 0.353553390593274, -0.490392640201615,  0.461939766255643, -0.415734806151273,  0.353553390593273, -0.277785116509801,  0.191341716182545, -0.097545161008064 }
+};
+
+void idctFloat8x8(const float *coeffs, float *result) {
+	// IDCT code based on JPEG's IDCT code
+	// TODO: Switch to the integer-based one mentioned in the docs
+
+	float tmp[8 * 8];
+
+	// Apply 1D IDCT to rows
+	for (int y = 0; y < 8; y++, coeffs += 8) {
+		// Most rows of a quantized block have no AC coefficients at all.
+		// Adding the zero terms does not change the sum, so these rows
+		// can be done without the full matrix multiplication.
+		if ((coeffs[1] == 0.0f) && (coeffs[2] == 0.0f) && (coeffs[3] == 0.0f) && (coeffs[4] == 0.0f) &&
+		    (coeffs[5] == 0.0f) && (coeffs[6] == 0.0f) && (coeffs[7] == 0.0f)) {
+			const float dc = coeffs[0] * s_idct8x8[0][0];
+			for (int x = 0; x < 8; x++)
+				tmp[y + x * 8] = dc;
+
+			continue;
+		}
+
+		for (int x = 0; x < 8; x++) {
+			tmp[y + x * 8] = coeffs[0] * s_idct8x8[x][0]
+			               + coeffs[1] * s_idct8x8[x][1]
+			               + coeffs[2] * s_idct8x8[x][2]
+			               + coeffs[3] * s_idct8x8[x][3]
+			               + coeffs[4] * s_idct8x8[x][4]
+			               + coeffs[5] * s_idct8x8[x][5]
+			               + coeffs[6] * s_idct8x8[x][6]
+			               + coeffs[7] * s_idct8x8[x][7];
+		}
+	}
+
+	// Apply 1D IDCT to columns
+	for (int x = 0; x < 8; x++) {
+		const float *u = tmp + x * 8;
+		for (int y = 0; y < 8; y++) {
+			result[y * 8 + x] = u[0] * s_idct8x8[y][0]
+			                  + u[1] * s_idct8x8[y][1]
+			                  + u[2] * s_idct8x8[y][2]
+			                  + u[3] * s_idct8x8[y][3]
+			                  + u[4] * s_idct8x8[y][4]
+			                  + u[5] * s_idct8x8[y][5]
+			                  + u[6] * s_idct8x8[y][6]
+			                  + u[7] * s_idct8x8[y][7];
+		}
+	}
+}
+
+} // End of namespace DSP
+
+} // End of namespace Video
@@ -0,0 +1,92 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#ifndef VIDEO_DSP_H
+#define VIDEO_DSP_H
+
+#include "common/scummsys.h"
+
+namespace Video {
+
+/**
+ * Block-level DSP kernels shared by the software video decoders.
+ *
+ * All pixel functions operate on 8-bit planes. The source and destination
+ * of the copy and interpolation functions share the same pitch, since the
+ * decoders always predict from a previous frame of the same size.
+ *
+ * The kernels work on 32 bits at a time where possible and are bit-exact
+ * with the per-pixel formulas noted at each function.
+ */
+namespace DSP {
+
+/** Copy an 8 pixels wide block of h lines. */
+void putPixels8(byte *block, const byte *pixels, int pitch, int h);
+/** Copy a 16 pixels wide block of h lines. */
+void putPixels16(byte *block, const byte *pixels, int pitch, int h);
+
+/** Horizontal halfpel interpolation of an 8 pixels wide block, (a + b + 1) >> 1. */
+void putPixels8X2(byte *block, const byte *pixels, int pitch, int h);
+/** Vertical halfpel interpolation of an 8 pixels wide block, (a + b + 1) >> 1. */
+void putPixels8Y2(byte *block, const byte *pixels, int pitch, int h);
+/** Diagonal halfpel interpolation of an 8 pixels wide block, (a + b + c + d + 2) >> 2. */
+void putPixels8XY2(byte *block, const byte *pixels, int pitch, int h);
+
+/** Horizontal halfpel interpolation of a 16 pixels wide block, (a + b + 1) >> 1. */
+void putPixels16X2(byte *block, const byte *pixels, int pitch, int h);
+/** Vertical halfpel interpolation of a 16 pixels wide block, (a + b + 1) >> 1. */
+void putPixels16Y2(byte *block, const byte *pixels, int pitch, int h);
+/** Diagonal halfpel interpolation of a 16 pixels wide block, (a + b + c + d + 2) >> 2. */
+void putPixels16XY2(byte *block, const byte *pixels, int pitch, int h);
+
+/** Fill an 8x8 block with a single value. */
+void fillBlock8(byte *block, byte value, int pitch);
+/** Fill a 16x16 block with a single value. */
+void fillBlock16(byte *block, byte value, int pitch);
+
+/**
+ * Add an 8x8 block of coefficients to the pixels.
+ *
+ * The sum wraps around instead of being clamped, as required by Bink.
+ */
+void addBlock8(byte *block, const int16 *src, int pitch);
+
+/** In-place Bink 8x8 integer inverse DCT. */
+void binkIDCT(int16 *block);
+/** Bink inverse DCT of the coefficients, written to the pixels. */
+void binkIDCTPut(byte *block, const int16 *coeffs, int pitch);
+/** Bink inverse DCT of the coefficients, added (wrapping) to the pixels. */
+void binkIDCTAdd(byte *block, int16 *coeffs, int pitch);
+
+/**
+ * Floating point 8x8 inverse DCT, as used by the PlayStation MDEC.
+ *
+ * The result is in the signed range [-128, 127] before clipping.
+ */
+void idctFloat8x8(const float *coeffs, float *result);
+
+} // End of namespace DSP
+
+} // End of namespace Video
+
+#endif
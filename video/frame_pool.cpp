@@ -0,0 +1,92 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#include "video/frame_pool.h"
+
+#include "graphics/surface.h"
+
+namespace Video {
+
+FramePool::FramePool(uint maxFree) : _maxFree(maxFree), _allocationCount(0) {
+}
+
+FramePool::~FramePool() {
+	clear();
+}
+
+Graphics::Surface *FramePool::acquire(uint16 width, uint16 height, const Graphics::PixelFormat &format) {
+	// Prefer the most recently released surface, it is likely still cached
+	for (int i = _free.size() - 1; i >= 0; i--) {
+		Graphics::Surface *surface = _free[i];
+
+		if (surface->w == width && surface->h == height && surface->format == format) {
+			_free.remove_at(i);
+			return surface;
+		}
+	}
+
+	uint16 pitch = (width * format.bytesPerPixel + kPitchAlignment - 1) & ~(kPitchAlignment - 1);
+	void *pixels = 0;
+
+	if (width && height) {
+		pixels = calloc(height, pitch);
+		assert(pixels);
+	}
+
+	Graphics::Surface *surface = new Graphics::Surface();
+	surface->init(width, height, pitch, pixels, format);
+	_allocationCount++;
+	return surface;
+}
+
+void FramePool::release(Graphics::Surface *surface) {
+	if (!surface)
+		return;
+
+	// Drop the oldest surface if the pool is full
+	if (_free.size() >= _maxFree) {
+		if (_free.empty()) {
+			freeSurface(surface);
+			return;
+		}
+
+		freeSurface(_free[0]);
+		_free.remove_at(0);
+	}
+
+	_free.push_back(surface);
+}
+
+void FramePool::clear() {
+	for (uint i = 0; i < _free.size(); i++)
+		freeSurface(_free[i]);
+
+	_free.clear();
+}
+
+void FramePool::freeSurface(Graphics::Surface *surface) {
+	surface->free();
+	delete surface;
+}
+
+} // End of namespace Video
@@ -0,0 +1,92 @@
+/* ScummVM - Graphic Adventure Engine
+ *
+ * ScummVM is the legal property of its developers, whose names
+ * are too numerous to list here. Please refer to the COPYRIGHT
+ * file distributed with this source distribution.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ */
+
+
+#ifndef VIDEO_FRAME_POOL_H
+#define VIDEO_FRAME_POOL_H
+
+#include "common/array.h"
+#include "graphics/pixelformat.h"
+
+namespace Graphics {
+struct Surface;
+}
+
+namespace Video {
+
+/**
+ * A pool of frame surfaces.
+ *
+ * Decoders which need a fresh surface per frame, or whenever the frame
+ * size or format changes, take one from the pool and hand it back once
+ * the frame is no longer needed. Playback at a constant frame size then
+ * keeps reusing the same buffers instead of allocating new ones.
+ *
+ * Rows of pooled surfaces are padded to a multiple of kPitchAlignment
+ * bytes, so users must honor the surface pitch.
+ */
+class FramePool {
+public:
+	/** Row alignment of pooled surfaces, in bytes. */
+	static const uint kPitchAlignment = 16;
+
+	/**
+	 * @param maxFree The maximum number of released surfaces to keep
+	 */
+	FramePool(uint maxFree = 4);
+	~FramePool();
+
+	/**
+	 * Get a surface of the given size and format.
+	 *
+	 * A released surface of the same size and format is reused if there
+	 * is one; its contents are whatever was last written to it. Newly
+	 * allocated surfaces are cleared.
+	 */
+	Graphics::Surface *acquire(uint16 width, uint16 height, const Graphics::PixelFormat &format);
+
+	/**
+	 * Hand a surface obtained from acquire() back to the pool.
+	 */
+	void release(Graphics::Surface *surface);
+
+	/**
+	 * Free all surfaces currently held by the pool.
+	 */
+	void clear();
+
+	/**
+	 * Return how many surfaces the pool allocated so far.
+	 */
+	uint getAllocationCount() const { return _allocationCount; }
+
+private:
+	Common::Array<Graphics::Surface *> _free;
+	uint _maxFree;
+	uint _allocationCount;
+
+	static void freeSurface(Graphics::Surface *surface);
+};
+
+} // End of namespace Video
+
+#endif
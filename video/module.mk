@@ -3,6 +3,8 @@ MODULE := video
 MODULE_OBJS := \
 	avi_decoder.o \
 	coktel_decoder.o \
+	dsp.o \
+	frame_pool.o \
 	dxa_decoder.o \
 	flic_decoder.o \
 	psx_decoder.o \
@@ -37,5 +39,10 @@ MODULE_OBJS += \
 	codecs/mpeg.o
 endif
 
+ifdef ENABLE_BENCHMARKS
+MODULE_OBJS += \
+	benchmark.o
+endif
+
 # Include common rules
 include $(srcdir)/rules.mk
@@ -34,6 +34,7 @@
 #include "common/textconsole.h"
 #include "graphics/yuv_to_rgb.h"
 
+#include "video/dsp.h"
 #include "video/psx_decoder.h"
 
 namespace Video {
@@ -619,59 +620,6 @@ int PSXStreamDecoder::PSXVideoTrack::readSignedCoefficient(Common::BitStream *bi
 	return (int)(val << shift) >> shift;
 }
 
-// IDCT table built with :
-// _idct8x8[x][y] = cos(((2 * x + 1) * y) * (M_PI / 16.0)) * 0.5;
-// _idct8x8[x][y] /= sqrt(2.0) if y == 0
-static const double s_idct8x8[8][8] = {
-	{ 0.353553390593274,  0.490392640201615,  0.461939766255643,  0.415734806151273,  0.353553390593274,  0.277785116509801,  0.191341716182545,  0.097545161008064 },
-	{ 0.353553390593274,  0.415734806151273,  0.191341716182545, -0.097545161008064, -0.353553390593274, -0.490392640201615, -0.461939766255643, -0.277785116509801 },
-	{ 0.353553390593274,  0.277785116509801, -0.191341716182545, -0.490392640201615, -0.353553390593274,  0.097545161008064,  0.461939766255643,  0.415734806151273 },
-	{ 0.353553390593274,  0.097545161008064, -0.461939766255643, -0.277785116509801,  0.353553390593274,  0.415734806151273, -0.191341716182545, -0.490392640201615 },
-	{ 0.353553390593274, -0.097545161008064, -0.461939766255643,  0.277785116509801,  0.353553390593274, -0.415734806151273, -0.191341716182545,  0.490392640201615 },
-	{ 0.353553390593274, -0.277785116509801, -0.191341716182545,  0.490392640201615, -0.353553390593273, -0.097545161008064,  0.461939766255643, -0.415734806151273 },
-	{ 0.353553390593274, -0.415734806151273,  0.191341716182545,  0.097545161008064, -0.353553390593274,  0.490392640201615, -0.461939766255643,  0.277785116509801 },
-	{ 0.353553390593274, -0.490392640201615,  0.461939766255643, -0.415734806151273,  0.353553390593273, -0.277785116509801,  0.191341716182545, -0.097545161008064 }
-};
-
-void PSXStreamDecoder::PSXVideoTrack::idct(float *dequantData, float *result) {
-	// IDCT code based on JPEG's IDCT code
-	// TODO: Switch to the integer-based one mentioned in the docs
-	// This is by far the costliest operation here
-
-	float tmp[8 * 8];
-
-	// Apply 1D IDCT to rows
-	for (int y = 0; y < 8; y++) {
-		for (int x = 0; x < 8; x++) {
-			tmp[y + x * 8] = dequantData[0] * s_idct8x8[x][0]
-							+ dequantData[1] * s_idct8x8[x][1]
-							+ dequantData[2] * s_idct8x8[x][2]
-							+ dequantData[3] * s_idct8x8[x][3]
-							+ dequantData[4] * s_idct8x8[x][4]
-							+ dequantData[5] * s_idct8x8[x][5]
-							+ dequantData[6] * s_idct8x8[x][6]
-							+ dequantData[7] * s_idct8x8[x][7];
-		}
-
-		dequantData += 8;
-	}
-
-	// Apply 1D IDCT to columns
-	for (int x = 0; x < 8; x++) {
-		const float *u = tmp + x * 8;
-		for (int y = 0; y < 8; y++) {
-			result[y * 8 + x] = u[0] * s_idct8x8[y][0]
-								+ u[1] * s_idct8x8[y][1]
-								+ u[2] * s_idct8x8[y][2]
-								+ u[3] * s_idct8x8[y][3]
-								+ u[4] * s_idct8x8[y][4]
-								+ u[5] * s_idct8x8[y][5]
-								+ u[6] * s_idct8x8[y][6]
-								+ u[7] * s_idct8x8[y][7];
-		}
-	}
-}
-
 void PSXStreamDecoder::PSXVideoTrack::decodeBlock(Common::BitStream *bits, byte *block, int pitch, uint16 scale, uint16 version, PlaneType plane) {
 	// Version 2 just has signed 10 bits for DC
 	// Version 3 has them huffman coded
@@ -685,7 +633,7 @@ void PSXStreamDecoder::PSXVideoTrack::decodeBlock(Common::BitStream *bits, byte
 
 	// Perform IDCT
 	float idctData[8 * 8];
-	idct(dequantData, idctData);
+	DSP::idctFloat8x8(dequantData, idctData);
 
 	// Now output the data
 	for (int y = 0; y < 8; y++) {
@@ -119,7 +119,6 @@ private:
 		int _lastDC[3];
 
 		void dequantizeBlock(int *coefficients, float *block, uint16 scale);
-		void idct(float *dequantData, float *result);
 		int readSignedCoefficient(Common::BitStream *bits);
 	};
 
@@ -155,6 +155,15 @@ private:
 		mutable bool _dirtyPalette;
 		bool _reversed;
 
+		struct SampleEntry {
+			uint32 offset;
+			uint32 size;
+			uint32 descId;
+		};
+
+		Common::Array<SampleEntry> _samples;
+
+		void buildSampleIndex();
 		Common::SeekableReadStream *getNextFramePacket(uint32 &descId);
 		uint32 getFrameDuration();
 		uint32 findKeyFrame(uint32 frame) const;
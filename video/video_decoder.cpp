@@ -30,6 +30,7 @@
 #include "common/system.h"
 
 #include "graphics/palette.h"
+#include "graphics/surface.h"
 
 namespace Video {
 
@@ -47,6 +48,8 @@ VideoDecoder::VideoDecoder() {
 	_endTimeSet = false;
 	_nextVideoTrack = 0;
 	_mainAudioTrack = 0;
+	_decodeAhead = 0;
+	_aheadSurface = 0;
 
 	// Find the best format for output
 	_defaultHighColorFormat = g_system->getScreenFormat();
@@ -55,10 +58,16 @@ VideoDecoder::VideoDecoder() {
 		_defaultHighColorFormat = Graphics::PixelFormat(4, 8, 8, 8, 8, 8, 16, 24, 0);
 }
 
+VideoDecoder::~VideoDecoder() {
+	freeDecodeAhead();
+}
+
 void VideoDecoder::close() {
 	if (isPlaying())
 		stop();
 
+	freeDecodeAhead();
+
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		delete *it;
 
@@ -172,6 +181,24 @@ Graphics::PixelFormat VideoDecoder::getPixelFormat() const {
 const Graphics::Surface *VideoDecoder::decodeNextFrame() {
 	_needsUpdate = false;
 
+	// Hand out frames which have been decoded ahead first
+	if (!_aheadFrames.empty()) {
+		AheadFrame frame = _aheadFrames.pop();
+
+		// The previous frame is not in use anymore
+		_aheadPool.release(_aheadSurface);
+		_aheadSurface = frame.surface;
+
+		if (frame.palette) {
+			memcpy(_aheadPalette, frame.palette, sizeof(_aheadPalette));
+			delete[] frame.palette;
+			_palette = _aheadPalette;
+			_dirtyPalette = true;
+		}
+
+		return frame.surface;
+	}
+
 	readNextPacket();
 
 	// If we have no next video track at this point, there shouldn't be
@@ -197,6 +224,21 @@ bool VideoDecoder::setReverse(bool reverse) {
 	if (reverse && hasAudio())
 		return false;
 
+	// The tracks are ahead of the frame being shown when frames have been
+	// decoded ahead, so move them back first.
+	if (reverse && !_aheadFrames.empty()) {
+		if (!isSeekable())
+			return false;
+
+		Audio::Timestamp frameTime(_aheadFrames.front().startTime, 1000);
+		flushDecodeAhead();
+
+		if (!seekIntern(frameTime))
+			return false;
+
+		findNextVideoTrack();
+	}
+
 	// Attempt to make sure all the tracks are in the requested direction
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++) {
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && ((VideoTrack *)*it)->isReversed() != reverse) {
@@ -217,6 +259,13 @@ const byte *VideoDecoder::getPalette() {
 }
 
 int VideoDecoder::getCurFrame() const {
+	if (!_aheadFrames.empty())
+		return _aheadFrames.front().prevFrame;
+
+	return getTrackCurFrame();
+}
+
+int VideoDecoder::getTrackCurFrame() const {
 	int32 frame = -1;
 
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
@@ -258,10 +307,24 @@ uint32 VideoDecoder::getTime() const {
 }
 
 uint32 VideoDecoder::getTimeToNextFrame() const {
-	if (endOfVideo() || _needsUpdate || !_nextVideoTrack)
+	if (endOfVideo() || _needsUpdate)
 		return 0;
 
 	uint32 currentTime = getTime();
+
+	if (!_aheadFrames.empty()) {
+		// Frames are never decoded ahead in reverse
+		uint32 nextFrameStartTime = _aheadFrames.front().startTime;
+
+		if (nextFrameStartTime <= currentTime)
+			return 0;
+
+		return nextFrameStartTime - currentTime;
+	}
+
+	if (!_nextVideoTrack)
+		return 0;
+
 	uint32 nextFrameStartTime = _nextVideoTrack->getNextFrameStartTime();
 
 	if (_nextVideoTrack->isReversed()) {
@@ -280,6 +343,9 @@ uint32 VideoDecoder::getTimeToNextFrame() const {
 }
 
 bool VideoDecoder::endOfVideo() const {
+	if (!_aheadFrames.empty() && (!isPlaying() || !_endTimeSet || _aheadFrames.front().startTime < (uint)_endTime.msecs()))
+		return false;
+
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if (!(*it)->endOfTrack() && (!isPlaying() || (*it)->getTrackType() != Track::kTrackTypeVideo || !_endTimeSet || ((VideoTrack *)*it)->getNextFrameStartTime() < (uint)_endTime.msecs()))
 			return false;
@@ -306,6 +372,8 @@ bool VideoDecoder::rewind() {
 	if (isPlaying())
 		stopAudio();
 
+	flushDecodeAhead();
+
 	for (TrackList::iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if (!(*it)->rewind())
 			return false;
@@ -340,6 +408,8 @@ bool VideoDecoder::seek(const Audio::Timestamp &time) {
 	if (isPlaying())
 		stopAudio();
 
+	flushDecodeAhead();
+
 	// Do the actual seeking
 	if (!seekIntern(time))
 		return false;
@@ -848,6 +918,13 @@ bool VideoDecoder::hasFramesLeft() const {
 	// This is similar to endOfVideo(), except it doesn't take Audio into account (and returns true if not the end of the video)
 	// This is only used for needsUpdate() atm so that setEndTime() works properly
 	// And unlike endOfVideoTracks(), this takes into account _endTime
+	if (!_aheadFrames.empty())
+		return !isPlaying() || !_endTimeSet || _aheadFrames.front().startTime < (uint)_endTime.msecs();
+
+	return hasTrackFramesLeft();
+}
+
+bool VideoDecoder::hasTrackFramesLeft() const {
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if ((*it)->getTrackType() == Track::kTrackTypeVideo && !(*it)->endOfTrack() && (!isPlaying() || !_endTimeSet || ((VideoTrack *)*it)->getNextFrameStartTime() < (uint)_endTime.msecs()))
 			return true;
@@ -855,6 +932,72 @@ bool VideoDecoder::hasFramesLeft() const {
 	return false;
 }
 
+void VideoDecoder::setDecodeAhead(uint frames) {
+	// Frames which have already been decoded are still handed out
+	_decodeAhead = frames;
+}
+
+bool VideoDecoder::decodeAheadFrame() {
+	if (_aheadFrames.size() >= (int)_decodeAhead || !isPlaying() || isPaused())
+		return false;
+
+	if (!_nextVideoTrack || _nextVideoTrack->isReversed() || !hasTrackFramesLeft())
+		return false;
+
+	// This is what decodeNextFrame() would do when the frame is due
+	AheadFrame frame;
+	frame.startTime = _nextVideoTrack->getNextFrameStartTime();
+	frame.prevFrame = getTrackCurFrame();
+	frame.palette = 0;
+
+	readNextPacket();
+
+	if (!_nextVideoTrack)
+		return false;
+
+	const Graphics::Surface *surface = _nextVideoTrack->decodeNextFrame();
+	frame.surface = surface ? getAheadSurface(surface) : 0;
+
+	// The track's palette may change again before this frame is shown
+	if (_nextVideoTrack->hasDirtyPalette()) {
+		frame.palette = new byte[sizeof(_aheadPalette)];
+		memcpy(frame.palette, _nextVideoTrack->getPalette(), sizeof(_aheadPalette));
+	}
+
+	findNextVideoTrack();
+
+	_aheadFrames.push(frame);
+	return true;
+}
+
+Graphics::Surface *VideoDecoder::getAheadSurface(const Graphics::Surface *frame) {
+	// Reuse a surface of a frame which has already been shown
+	Graphics::Surface *surface = _aheadPool.acquire(frame->w, frame->h, frame->format);
+
+	for (int y = 0; y < frame->h; y++)
+		memcpy(surface->getBasePtr(0, y), frame->getBasePtr(0, y), frame->w * frame->format.bytesPerPixel);
+
+	return surface;
+}
+
+void VideoDecoder::flushDecodeAhead() {
+	while (!_aheadFrames.empty()) {
+		AheadFrame frame = _aheadFrames.pop();
+
+		_aheadPool.release(frame.surface);
+
+		delete[] frame.palette;
+	}
+}
+
+void VideoDecoder::freeDecodeAhead() {
+	flushDecodeAhead();
+
+	_aheadPool.release(_aheadSurface);
+	_aheadSurface = 0;
+	_aheadPool.clear();
+}
+
 bool VideoDecoder::hasAudio() const {
 	for (TrackList::const_iterator it = _tracks.begin(); it != _tracks.end(); it++)
 		if ((*it)->getTrackType() == Track::kTrackTypeAudio)
@@ -26,9 +26,11 @@
 #include "audio/mixer.h"
 #include "audio/timestamp.h"	// TODO: Move this to common/ ?
 #include "common/array.h"
+#include "common/queue.h"
 #include "common/rational.h"
 #include "common/str.h"
 #include "graphics/pixelformat.h"
+#include "video/frame_pool.h"
 
 namespace Audio {
 class AudioStream;
@@ -52,7 +54,7 @@ namespace Video {
 class VideoDecoder {
 public:
 	VideoDecoder();
-	virtual ~VideoDecoder() {}
+	virtual ~VideoDecoder();
 
 	/////////////////////////////////////////
 	// Opening/Closing a Video
@@ -344,6 +346,32 @@ public:
 	 */
 	virtual const Graphics::Surface *decodeNextFrame();
 
+	/**
+	 * Set the number of frames which may be decoded ahead of time.
+	 *
+	 * Decoding ahead is disabled by default. When enabled, the engine calls
+	 * decodeAheadFrame() while it waits for the next frame to be due, and
+	 * decodeNextFrame() hands the frames out from a queue. That way, the
+	 * cost of expensive frames (e.g. keyframes) is spread over the idle time
+	 * between frames. Palette changes are kept with each queued frame.
+	 *
+	 * Frames are not decoded ahead while playing in reverse.
+	 *
+	 * @note Frames decoded ahead are copied into surfaces owned by the
+	 *       VideoDecoder, so this costs one copy of each frame.
+	 * @param frames the maximum number of frames to decode ahead, 0 to disable
+	 */
+	void setDecodeAhead(uint frames);
+
+	/**
+	 * Decode one of the upcoming frames ahead of time, if decoding ahead is
+	 * enabled and the queue of decoded frames is not full yet.
+	 *
+	 * @return whether a frame was decoded
+	 * @see setDecodeAhead()
+	 */
+	bool decodeAheadFrame();
+
 	/**
 	 * Set the default high color format for videos that convert from YUV.
 	 *
@@ -893,6 +921,26 @@ private:
 	// Default PixelFormat settings
 	Graphics::PixelFormat _defaultHighColorFormat;
 
+	// Frames decoded ahead of time
+	struct AheadFrame {
+		Graphics::Surface *surface; ///< The frame, or 0 if the track did not return any
+		byte *palette;              ///< The new palette, or 0 if it did not change
+		uint32 startTime;           ///< The time when the frame is due
+		int prevFrame;              ///< The current frame before this one
+	};
+
+	uint _decodeAhead;
+	Common::Queue<AheadFrame> _aheadFrames;
+	FramePool _aheadPool;
+	Graphics::Surface *_aheadSurface;
+	byte _aheadPalette[256 * 3];
+
+	void flushDecodeAhead();
+	void freeDecodeAhead();
+	Graphics::Surface *getAheadSurface(const Graphics::Surface *frame);
+	int getTrackCurFrame() const;
+	bool hasTrackFramesLeft() const;
+
 	// Internal helper functions
 	void stopAudio();
 	void startAudio();